@@ -0,0 +1,462 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <RibbonCheckBox>
+#include <RibbonComboBox>
+#include <RibbonDropButton>
+#include <RibbonGroup>
+#include <RibbonIconCache>
+#include <RibbonInstrumentation>
+#include <RibbonPushButton>
+#include <RibbonStyle>
+#include <RibbonWidget>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QEnterEvent>
+#include <QFile>
+#include <QHBoxLayout>
+#include <QImage>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMouseEvent>
+#include <QTextStream>
+#include <QVBoxLayout>
+#include <ThemeSupport>
+#include <algorithm>
+#include <functional>
+
+constexpr auto DefaultTabs = 6;
+constexpr auto DefaultGroups = 6;
+constexpr auto DefaultControls = 4;
+constexpr auto DefaultIterations = 20;
+constexpr auto WindowWidth = 1200;
+constexpr auto WindowHeight = 300;
+constexpr auto MinimumResizeWidth = 400;
+constexpr auto ResizeStep = 40;
+constexpr auto HoverStep = 4;
+
+/**
+ * @brief       The parameters of a benchmark run.
+ */
+struct Parameters {
+    int tabs;
+    int groups;
+    int controls;
+    int iterations;
+};
+
+/**
+ * @brief       The ribbon under test and the window that hosts it.
+ */
+struct Fixture {
+    QWidget *window;
+    Nedrysoft::Ribbon::RibbonWidget *ribbonWidget;
+};
+
+static auto createPage(const Parameters &parameters) -> QWidget * {
+    auto page = new QWidget;
+    auto pageLayout = new QHBoxLayout(page);
+
+    pageLayout->setContentsMargins(0, 0, 0, 0);
+    pageLayout->setSpacing(0);
+
+    for (auto groupIndex=0;groupIndex<parameters.groups;groupIndex++) {
+        auto group = new Nedrysoft::Ribbon::RibbonGroup;
+        auto groupLayout = new QHBoxLayout(group);
+
+        group->setGroupName(QString("Group %1").arg(groupIndex+1));
+
+        for (auto controlIndex=0;controlIndex<parameters.controls;controlIndex++) {
+            switch(controlIndex%4) {
+                case 0: {
+                    auto pushButton = new Nedrysoft::Ribbon::RibbonPushButton;
+
+                    pushButton->setText("Push");
+
+                    groupLayout->addWidget(pushButton);
+
+                    break;
+                }
+
+                case 1: {
+                    auto dropButton = new Nedrysoft::Ribbon::RibbonDropButton;
+
+                    dropButton->setText("Drop");
+
+                    groupLayout->addWidget(dropButton);
+
+                    break;
+                }
+
+                case 2: {
+                    auto comboBox = new Nedrysoft::Ribbon::RibbonComboBox;
+
+                    comboBox->addItems(QStringList() << "Item 1" << "Item 2" << "Item 3");
+
+                    groupLayout->addWidget(comboBox);
+
+                    break;
+                }
+
+                default: {
+                    auto checkBox = new Nedrysoft::Ribbon::RibbonCheckBox;
+
+                    checkBox->setText("Check");
+
+                    groupLayout->addWidget(checkBox);
+
+                    break;
+                }
+            }
+        }
+
+        pageLayout->addWidget(group);
+    }
+
+    pageLayout->addStretch();
+
+    return page;
+}
+
+static auto createFixture(const Parameters &parameters) -> Fixture {
+    auto window = new QWidget;
+    auto windowLayout = new QVBoxLayout(window);
+    auto ribbonWidget = new Nedrysoft::Ribbon::RibbonWidget;
+
+    windowLayout->setContentsMargins(0, 0, 0, 0);
+    windowLayout->addWidget(ribbonWidget);
+    windowLayout->addStretch();
+
+    for (auto tabIndex=0;tabIndex<parameters.tabs;tabIndex++) {
+        ribbonWidget->addTab(createPage(parameters), QString("Tab %1").arg(tabIndex+1));
+    }
+
+    window->resize(WindowWidth, WindowHeight);
+
+    return Fixture{window, ribbonWidget};
+}
+
+static auto showFixture(const Fixture &fixture) -> void {
+    fixture.window->show();
+
+    QApplication::processEvents();
+}
+
+static auto sendEnter(QWidget *widget, const QPoint &position) -> void {
+    QEnterEvent enterEvent(
+            position,
+            widget->mapTo(widget->window(), position),
+            widget->mapToGlobal(position));
+
+    QApplication::sendEvent(widget, &enterEvent);
+}
+
+static auto sendMouseMove(QWidget *widget, const QPoint &position) -> void {
+    QMouseEvent mouseEvent(
+            QEvent::MouseMove,
+            position,
+            widget->mapToGlobal(position),
+            Qt::NoButton,
+            Qt::NoButton,
+            Qt::NoModifier);
+
+    QApplication::sendEvent(widget, &mouseEvent);
+}
+
+/**
+ * @brief       A benchmark scenario, the setup and teardown are not timed.
+ */
+struct Scenario {
+    QString name;
+    std::function<Fixture()> setup;
+    std::function<void(const Fixture &)> run;
+};
+
+static auto scenarios(const Parameters &parameters) -> QVector<Scenario> {
+    auto shownFixture = [parameters]() {
+        auto fixture = createFixture(parameters);
+
+        showFixture(fixture);
+
+        return fixture;
+    };
+
+    return QVector<Scenario>()
+        << Scenario{"construction", []() { return Fixture{nullptr, nullptr}; }, [parameters](const Fixture &) {
+            auto fixture = createFixture(parameters);
+
+            fixture.window->ensurePolished();
+            fixture.window->layout()->activate();
+
+            delete fixture.window;
+        }}
+        << Scenario{"themeChangedDispatch", shownFixture, [](const Fixture &) {
+            auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+
+            // the themeChanged signal is emitted for the opposite theme and back again, which restyles every
+            // registered control.  The theme itself is not changed, so code that reads isDarkMode() when painting
+            // paints in the current theme and this does not measure a complete switch.
+
+            Q_EMIT themeSupport->themeChanged(!themeSupport->isDarkMode());
+            Q_EMIT themeSupport->themeChanged(themeSupport->isDarkMode());
+        }}
+        << Scenario{"tabSwitch", shownFixture, [](const Fixture &fixture) {
+            for (auto index=0;index<fixture.ribbonWidget->count();index++) {
+                fixture.ribbonWidget->setCurrentIndex(index);
+
+                QApplication::processEvents();
+            }
+        }}
+        << Scenario{"hoverSweep", shownFixture, [](const Fixture &fixture) {
+            auto tabBar = fixture.ribbonWidget->tabBar();
+            auto y = tabBar->height()/2;
+
+            sendEnter(tabBar, QPoint(0, y));
+
+            for (auto x=0;x<tabBar->width();x+=HoverStep) {
+                sendMouseMove(tabBar, QPoint(x, y));
+            }
+
+            QEvent leaveEvent(QEvent::Leave);
+
+            QApplication::sendEvent(tabBar, &leaveEvent);
+
+            QApplication::processEvents();
+        }}
+        << Scenario{"resize", shownFixture, [](const Fixture &fixture) {
+            for (auto width=WindowWidth;width>=MinimumResizeWidth;width-=ResizeStep) {
+                fixture.window->resize(width, WindowHeight);
+
+                QApplication::processEvents();
+            }
+        }}
+        << Scenario{"resizeAdaptiveReduction", [shownFixture]() {
+            auto fixture = shownFixture();
+
+            fixture.ribbonWidget->setAdaptiveReduction(true);
+
+            return fixture;
+        }, [](const Fixture &fixture) {
+            for (auto width=WindowWidth;width>=MinimumResizeWidth;width-=ResizeStep) {
+                fixture.window->resize(width, WindowHeight);
+
+                QApplication::processEvents();
+            }
+        }}
+        << Scenario{"orientationToggle", shownFixture, [](const Fixture &fixture) {
+            auto dropButtons = fixture.window->findChildren<Nedrysoft::Ribbon::RibbonDropButton *>();
+
+            for (auto dropButton : dropButtons) {
+                dropButton->setVertical(!dropButton->vertical());
+            }
+
+            QApplication::processEvents();
+
+            for (auto dropButton : dropButtons) {
+                dropButton->setVertical(!dropButton->vertical());
+            }
+
+            QApplication::processEvents();
+        }}
+        << Scenario{"paint", shownFixture, [](const Fixture &fixture) {
+            QImage image(fixture.window->size(), QImage::Format_ARGB32_Premultiplied);
+
+            fixture.window->render(&image);
+        }};
+}
+
+static auto runScenario(const Scenario &scenario, int iterations) -> QJsonObject {
+    QElapsedTimer timer;
+    QVector<qint64> durations;
+
+    for (auto iteration=0;iteration<iterations;iteration++) {
+        auto fixture = scenario.setup();
+
+        timer.start();
+
+        scenario.run(fixture);
+
+        durations.append(timer.nsecsElapsed());
+
+        delete fixture.window;
+    }
+
+    std::sort(durations.begin(), durations.end());
+
+    qint64 total = 0;
+
+    for (auto duration : durations) {
+        total += duration;
+    }
+
+    QJsonObject result;
+
+    result["name"] = scenario.name;
+    result["iterations"] = iterations;
+    result["minNs"] = static_cast<double>(durations.first());
+    result["maxNs"] = static_cast<double>(durations.last());
+    result["medianNs"] = static_cast<double>(durations.at(durations.count()/2));
+    result["meanNs"] = static_cast<double>(total)/iterations;
+
+    return result;
+}
+
+int main(int argc, char **argv) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication application(argc, argv);
+
+    QCommandLineParser parser;
+
+    parser.setApplicationDescription("Measures the performance of the ribbon controls.");
+    parser.addHelpOption();
+
+    QCommandLineOption tabsOption("tabs", "Number of tabs.", "count", QString::number(DefaultTabs));
+    QCommandLineOption groupsOption("groups", "Number of groups per tab.", "count", QString::number(DefaultGroups));
+
+    QCommandLineOption controlsOption(
+            "controls",
+            "Number of controls per group.",
+            "count",
+            QString::number(DefaultControls));
+
+    QCommandLineOption iterationsOption(
+            "iterations",
+            "Number of iterations of each scenario.",
+            "count",
+            QString::number(DefaultIterations));
+
+    QCommandLineOption scenarioOption("scenario", "Only run the named scenario.", "name");
+    QCommandLineOption styleOption("ribbon-style", "Use RibbonStyle instead of stylesheets.");
+    QCommandLineOption outputOption("output", "Write the results to the file instead of stdout.", "file");
+    QCommandLineOption traceOption("trace", "Write a Chrome trace to the file (requires instrumentation).", "file");
+
+    parser.addOptions({
+        tabsOption,
+        groupsOption,
+        controlsOption,
+        iterationsOption,
+        scenarioOption,
+        styleOption,
+        outputOption,
+        traceOption
+    });
+
+    parser.process(application);
+
+    auto parameters = Parameters{
+        qMax(1, parser.value(tabsOption).toInt()),
+        qMax(1, parser.value(groupsOption).toInt()),
+        qMax(1, parser.value(controlsOption).toInt()),
+        qMax(1, parser.value(iterationsOption).toInt())
+    };
+
+    if (parser.isSet(styleOption)) {
+        QApplication::setStyle(new Nedrysoft::Ribbon::RibbonStyle);
+    }
+
+    auto instrumentation = Nedrysoft::Ribbon::RibbonInstrumentation::getInstance();
+
+    instrumentation->setTraceEnabled(parser.isSet(traceOption));
+
+    QJsonArray results;
+
+    for (auto &scenario : scenarios(parameters)) {
+        if ((parser.isSet(scenarioOption)) && (parser.value(scenarioOption)!=scenario.name)) {
+            continue;
+        }
+
+        results.append(runScenario(scenario, parameters.iterations));
+    }
+
+    QJsonObject parametersObject;
+
+    parametersObject["tabs"] = parameters.tabs;
+    parametersObject["groups"] = parameters.groups;
+    parametersObject["controls"] = parameters.controls;
+
+    QJsonObject report;
+
+    report["benchmark"] = "RibbonBenchmark";
+    report["qtVersion"] = qVersion();
+    report["platform"] = QGuiApplication::platformName();
+    report["style"] = parser.isSet(styleOption) ? "RibbonStyle" : "stylesheet";
+    report["parameters"] = parametersObject;
+    report["scenarios"] = results;
+
+    auto iconCache = Nedrysoft::Ribbon::RibbonIconCache::getInstance();
+
+    QJsonObject iconCacheObject;
+
+    iconCacheObject["hits"] = static_cast<double>(iconCache->hits());
+    iconCacheObject["misses"] = static_cast<double>(iconCache->misses());
+    iconCacheObject["hitRate"] = iconCache->hitRate();
+    iconCacheObject["memoryBytes"] = static_cast<double>(iconCache->memoryUsage());
+
+    report["iconCache"] = iconCacheObject;
+
+    if (Nedrysoft::Ribbon::RibbonInstrumentation::isCompiledIn()) {
+        QJsonArray statistics;
+
+        for (auto &statistic : instrumentation->statistics()) {
+            QJsonObject statisticObject;
+
+            statisticObject["class"] = statistic.className;
+            statisticObject["category"] = Nedrysoft::Ribbon::RibbonInstrumentation::categoryName(statistic.category);
+            statisticObject["count"] = static_cast<double>(statistic.count);
+            statisticObject["totalNs"] = static_cast<double>(statistic.totalTime);
+            statisticObject["maxNs"] = static_cast<double>(statistic.maxTime);
+
+            statistics.append(statisticObject);
+        }
+
+        report["instrumentation"] = statistics;
+    }
+
+    if ((parser.isSet(traceOption)) && (!instrumentation->writeTrace(parser.value(traceOption)))) {
+        QTextStream(stderr) << "unable to write " << parser.value(traceOption) << "\n";
+    }
+
+    auto json = QJsonDocument(report).toJson();
+
+    if (parser.isSet(outputOption)) {
+        QFile file(parser.value(outputOption));
+
+        if (!file.open(QIODevice::WriteOnly)) {
+            QTextStream(stderr) << "unable to write " << parser.value(outputOption) << "\n";
+
+            return 1;
+        }
+
+        file.write(json);
+    } else {
+        QTextStream(stdout) << json;
+    }
+
+    return 0;
+}
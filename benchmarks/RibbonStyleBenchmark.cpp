@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <RibbonButton>
+#include <RibbonCheckBox>
+#include <RibbonComboBox>
+#include <RibbonLineEdit>
+#include <RibbonSlider>
+#include <RibbonStyle>
+#include <RibbonToolButton>
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QGridLayout>
+#include <QImage>
+#include <QTextStream>
+
+constexpr auto ControlCount = 100;
+constexpr auto Iterations = 10;
+
+static auto createControls(QWidget *parent) -> void {
+    auto layout = new QGridLayout(parent);
+
+    for (auto row=0;row<ControlCount;row++) {
+        auto comboBox = new Nedrysoft::Ribbon::RibbonComboBox;
+        auto lineEdit = new Nedrysoft::Ribbon::RibbonLineEdit;
+        auto slider = new Nedrysoft::Ribbon::RibbonSlider;
+        auto checkBox = new Nedrysoft::Ribbon::RibbonCheckBox;
+
+        comboBox->addItems(QStringList() << "Item 1" << "Item 2" << "Item 3");
+        lineEdit->setText("Text");
+        slider->setOrientation(Qt::Horizontal);
+        checkBox->setText("Check");
+
+        layout->addWidget(new Nedrysoft::Ribbon::RibbonButton, row, 0);
+        layout->addWidget(new Nedrysoft::Ribbon::RibbonToolButton, row, 1);
+        layout->addWidget(comboBox, row, 2);
+        layout->addWidget(checkBox, row, 3);
+        layout->addWidget(slider, row, 4);
+        layout->addWidget(lineEdit, row, 5);
+    }
+}
+
+static auto runBenchmark(const QString &name) -> void {
+    QElapsedTimer timer;
+    qint64 constructionTime = 0;
+    qint64 paintTime = 0;
+
+    for (auto iteration=0;iteration<Iterations;iteration++) {
+        timer.start();
+
+        auto container = new QWidget;
+
+        createControls(container);
+
+        container->ensurePolished();
+        container->layout()->activate();
+        container->resize(container->sizeHint());
+
+        constructionTime += timer.nsecsElapsed();
+
+        QImage image(container->size(), QImage::Format_ARGB32_Premultiplied);
+
+        timer.start();
+
+        container->render(&image);
+
+        paintTime += timer.nsecsElapsed();
+
+        delete container;
+    }
+
+    QTextStream(stdout)
+            << QString("%1: construction %2 ms, paint %3 ms (%4 controls, mean of %5 runs)")
+                .arg(name, -12)
+                .arg(static_cast<double>(constructionTime)/Iterations/1.0e6, 0, 'f', 3)
+                .arg(static_cast<double>(paintTime)/Iterations/1.0e6, 0, 'f', 3)
+                .arg(ControlCount*6)
+                .arg(Iterations)
+            << "\n";
+}
+
+int main(int argc, char **argv) {
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QApplication application(argc, argv);
+
+    runBenchmark("stylesheet");
+
+    QApplication::setStyle(new Nedrysoft::Ribbon::RibbonStyle);
+
+    runBenchmark("RibbonStyle");
+
+    return 0;
+}
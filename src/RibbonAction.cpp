@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonAction.h"
+
+#include "RibbonDropButton.h"
+#include "RibbonSplitButton.h"
+
+#include <QMetaProperty>
+#include <QTimer>
+
+/**
+ * @brief       Writes a property of the widget if the widget has the property.
+ *
+ * @param[in]   widget the widget.
+ * @param[in]   name the name of the property.
+ * @param[in]   value the value to write.
+ */
+static auto writeProperty(QWidget *widget, const char *name, const QVariant &value) -> void {
+    auto metaObject = widget->metaObject();
+    auto propertyIndex = metaObject->indexOfProperty(name);
+
+    if (propertyIndex<0) {
+        return;
+    }
+
+    auto property = metaObject->property(propertyIndex);
+
+    if (property.isWritable()) {
+        property.write(widget, value);
+    }
+}
+
+Nedrysoft::Ribbon::DropButtonClickedEvent::DropButtonClickedEvent(
+        Nedrysoft::Ribbon::RibbonDropButton *dropButton,
+        bool dropDown) :
+
+        Nedrysoft::Ribbon::Event(StaticType),
+        m_sender(dropButton),
+        m_button(dropButton),
+        m_splitButton(nullptr),
+        m_dropDown(dropDown) {
+
+}
+
+Nedrysoft::Ribbon::DropButtonClickedEvent::DropButtonClickedEvent(
+        Nedrysoft::Ribbon::RibbonSplitButton *splitButton,
+        bool dropDown) :
+
+        Nedrysoft::Ribbon::Event(StaticType),
+        m_sender(splitButton),
+        m_button(nullptr),
+        m_splitButton(splitButton),
+        m_dropDown(dropDown) {
+
+}
+
+Nedrysoft::Ribbon::RibbonAction::RibbonAction(QObject *parent) :
+        QObject(parent) {
+
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::setEnabled(bool state) -> void {
+    if (m_state.enabled==state) {
+        m_suppressedUpdates++;
+
+        return;
+    }
+
+    m_state.enabled = state;
+
+    scheduleFlush();
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::isEnabled() const -> bool {
+    return m_state.enabled;
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::setChecked(bool state) -> void {
+    if (m_state.checked==state) {
+        m_suppressedUpdates++;
+
+        return;
+    }
+
+    m_state.checked = state;
+
+    scheduleFlush();
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::isChecked() const -> bool {
+    return m_state.checked;
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::setVisible(bool state) -> void {
+    if (m_state.visible==state) {
+        m_suppressedUpdates++;
+
+        return;
+    }
+
+    m_state.visible = state;
+
+    scheduleFlush();
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::isVisible() const -> bool {
+    return m_state.visible;
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::setText(const QString &text) -> void {
+    if (m_state.text==text) {
+        m_suppressedUpdates++;
+
+        return;
+    }
+
+    m_state.text = text;
+
+    scheduleFlush();
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::text() const -> QString {
+    return m_state.text;
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::addWidget(QWidget *widget) -> void {
+    if ((!widget) || (m_widgets.contains(widget))) {
+        return;
+    }
+
+    m_widgets.append(widget);
+
+    // only the values that differ from the default state are written, so a new widget keeps its own settings
+    // until the action changes them.
+
+    applyState(widget, m_appliedState, State());
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::removeWidget(QWidget *widget) -> void {
+    m_widgets.removeAll(widget);
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::flush() -> void {
+    m_flushScheduled = false;
+
+    auto hasChanges = (m_state.enabled!=m_appliedState.enabled) ||
+                      (m_state.checked!=m_appliedState.checked) ||
+                      (m_state.visible!=m_appliedState.visible) ||
+                      (m_state.text!=m_appliedState.text);
+
+    // the state may have been changed and then changed back before the flush, in which case there is nothing to do.
+
+    if (!hasChanges) {
+        m_suppressedUpdates++;
+
+        return;
+    }
+
+    m_widgets.removeAll(nullptr);
+
+    for (auto &widget : m_widgets) {
+        applyState(widget, m_state, m_appliedState);
+    }
+
+    m_appliedState = m_state;
+
+    Q_EMIT changed();
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::suppressedUpdates() const -> quint64 {
+    return m_suppressedUpdates;
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::unsubscribe(int id) -> void {
+    for (auto &subscriptions : m_subscriptions) {
+        for (auto index = 0; index<subscriptions.count(); index++) {
+            if (subscriptions.at(index).id==id) {
+                subscriptions.removeAt(index);
+
+                return;
+            }
+        }
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::triggerEvent(Nedrysoft::Ribbon::Event *event) -> void {
+    auto type = static_cast<int>(event->type());
+
+    if ((type>=0) && (type<static_cast<int>(Nedrysoft::Ribbon::EventType::Count))) {
+        // the copy only shares the list (a handler may unsubscribe during the dispatch), iterating it as const
+        // prevents it from detaching.
+
+        const auto subscriptions = m_subscriptions[type];
+
+        for (const auto &subscription : subscriptions) {
+            subscription.handler(*event);
+        }
+    }
+
+    static const auto ribbonEventSignal = QMetaMethod::fromSignal(&RibbonAction::ribbonEvent);
+
+    if (isSignalConnected(ribbonEventSignal)) {
+        Q_EMIT ribbonEvent(event);
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::scheduleFlush() -> void {
+    if (m_flushScheduled) {
+        // an update is already pending, this change will be applied with it.
+
+        m_suppressedUpdates++;
+
+        return;
+    }
+
+    m_flushScheduled = true;
+
+    QTimer::singleShot(0, this, [=]() {
+        if (m_flushScheduled) {
+            flush();
+        }
+    });
+}
+
+auto Nedrysoft::Ribbon::RibbonAction::applyState(
+        QWidget *widget,
+        const State &state,
+        const State &appliedState) -> void {
+
+    if (state.enabled!=appliedState.enabled) {
+        widget->setEnabled(state.enabled);
+    }
+
+    if (state.visible!=appliedState.visible) {
+        widget->setVisible(state.visible);
+    }
+
+    if (state.checked!=appliedState.checked) {
+        writeProperty(widget, "checked", state.checked);
+    }
+
+    if (state.text!=appliedState.text) {
+        writeProperty(widget, "text", state.text);
+    }
+}
@@ -24,47 +24,119 @@
 #ifndef PINGNOO_COMPONENTS_CORE_RIBBONACTION_H
 #define PINGNOO_COMPONENTS_CORE_RIBBONACTION_H
 
+#include "RibbonSpec.h"
+
+#include <QMetaMethod>
 #include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QVector>
+#include <QWidget>
+#include <array>
+#include <functional>
 
 namespace Nedrysoft { namespace Ribbon {
     class RibbonDropButton;
+    class RibbonSplitButton;
 
     enum class EventType {
         Null,
-        DropButtonClicked
+        DropButtonClicked,
+        Count                                                                   /**< Count of event types (last). */
     };
 
+    /**
+     * @brief       The Event class is the base class of all ribbon events.
+     *
+     * @details     Events carry their type as a compile time tag (StaticType) which is stored in the event when it
+     *              is constructed, events are intended to be constructed on the stack by the sender and are only
+     *              valid for the duration of the dispatch.
+     */
     class Event {
         public:
-            virtual auto type() -> Nedrysoft::Ribbon::EventType {
-                return Nedrysoft::Ribbon::EventType::Null;
+            static constexpr Nedrysoft::Ribbon::EventType StaticType = Nedrysoft::Ribbon::EventType::Null;
+
+            /**
+             * @brief       Constructs a new event of the given type.
+             *
+             * @param[in]   type the type of the event.
+             */
+            explicit Event(Nedrysoft::Ribbon::EventType type = StaticType) :
+                    m_type(type) {
+
+            }
+
+            virtual ~Event() = default;
+
+            /**
+             * @brief       Returns the type of the event.
+             *
+             * @returns     the event type.
+             */
+            auto type() const -> Nedrysoft::Ribbon::EventType {
+                return m_type;
             }
+
+        private:
+            //! @cond
+
+            Nedrysoft::Ribbon::EventType m_type;
+
+            //! @endcond
     };
 
+    /**
+     * @brief       Casts an event to the given event class if the type of the event matches.
+     *
+     * @param[in]   event the event.
+     *
+     * @returns     the event as EventClass if the type matches; otherwise nullptr.
+     */
+    template <class EventClass>
+    auto event_cast(Nedrysoft::Ribbon::Event *event) -> EventClass * {
+        if ((event) && (event->type()==EventClass::StaticType)) {
+            return static_cast<EventClass *>(event);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief       The DropButtonClickedEvent is triggered when a RibbonDropButton or a RibbonSplitButton is clicked.
+     *
+     * @note        sender() is set for both kinds of button, button() is only set for a RibbonDropButton and
+     *              splitButton() is only set for a RibbonSplitButton.
+     */
     class DropButtonClickedEvent :
         public Nedrysoft::Ribbon::Event {
 
         public:
-            DropButtonClickedEvent(RibbonDropButton *dropButton, bool dropDown) :
-                    m_button(dropButton),
-                    m_dropDown(dropDown) {
+            static constexpr Nedrysoft::Ribbon::EventType StaticType = Nedrysoft::Ribbon::EventType::DropButtonClicked;
 
-            }
+            NEDRYSOFT_RIBBON_WIDGET_EXPORT DropButtonClickedEvent(RibbonDropButton *dropButton, bool dropDown);
+
+            NEDRYSOFT_RIBBON_WIDGET_EXPORT DropButtonClickedEvent(RibbonSplitButton *splitButton, bool dropDown);
 
-            auto type() -> Nedrysoft::Ribbon::EventType override {
-                return Nedrysoft::Ribbon::EventType::DropButtonClicked;
+            auto sender() const -> QWidget * {
+                return m_sender;
             }
 
-            auto button() -> RibbonDropButton * {
+            auto button() const -> RibbonDropButton * {
                 return m_button;
             }
 
-            auto dropDown() -> bool {
+            auto splitButton() const -> RibbonSplitButton * {
+                return m_splitButton;
+            }
+
+            auto dropDown() const -> bool {
                 return m_dropDown;
             }
 
         private:
+            QWidget *m_sender;
             Nedrysoft::Ribbon::RibbonDropButton *m_button;
+            Nedrysoft::Ribbon::RibbonSplitButton *m_splitButton;
             bool m_dropDown;
     };
 
@@ -72,33 +144,162 @@ namespace Nedrysoft { namespace Ribbon {
     /**
      * @brief       The RibbonAction class provides a QAction style object which is used by the ribbon bar
      *              to indicate that an action has been triggered by the user.
+     *
+     * @details     Events can be received either by connecting to the ribbonEvent signal or, without any casting
+     *              in the handler, by subscribing to a specific event class with subscribe().
+     *
+     *              The enabled, checked, visible and text state of the action is applied to the widgets that are
+     *              bound to it.  Changes are coalesced, however many times the state is changed, the bound widgets
+     *              are updated at most once per pass of the event loop and only with the values that differ from
+     *              those last applied.
      */
-    class RibbonAction :
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonAction :
             public QObject {
 
         private:
             Q_OBJECT
 
         public:
+            /**
+             * @brief       Constructs a new RibbonAction which is a child of the parent.
+             *
+             * @param[in]   parent the owner object.
+             */
+            explicit RibbonAction(QObject *parent=nullptr);
+
             /**
              * @brief       Sets whether the ribbon action is enabled.
              *
-             * @note        The ribbon action state can be used to synchonise ribbon items enabled state.
+             * @note        The bound widgets are enabled or disabled on the next pass of the event loop.
              *
              * @param[in]   state should be true if the action is enabled; otherwise false.
              */
-            auto setEnabled(bool state) -> void {
-                m_enabled = state;
+            auto setEnabled(bool state) -> void;
+
+            /**
+             * @brief       Returns whether the ribbon action is enabled.
+             *
+             * @returns     true if enabled; otherwise false.
+             */
+            auto isEnabled() const -> bool;
+
+            /**
+             * @brief       Sets whether the ribbon action is checked.
+             *
+             * @note        Applied to bound widgets that have a checked property.
+             *
+             * @param[in]   state should be true if the action is checked; otherwise false.
+             */
+            auto setChecked(bool state) -> void;
+
+            /**
+             * @brief       Returns whether the ribbon action is checked.
+             *
+             * @returns     true if checked; otherwise false.
+             */
+            auto isChecked() const -> bool;
+
+            /**
+             * @brief       Sets whether the widgets bound to the ribbon action are visible.
+             *
+             * @param[in]   state should be true if the widgets are visible; otherwise false.
+             */
+            auto setVisible(bool state) -> void;
+
+            /**
+             * @brief       Returns whether the widgets bound to the ribbon action are visible.
+             *
+             * @returns     true if visible; otherwise false.
+             */
+            auto isVisible() const -> bool;
+
+            /**
+             * @brief       Sets the text of the ribbon action.
+             *
+             * @note        Applied to bound widgets that have a text property.
+             *
+             * @param[in]   text the text.
+             */
+            auto setText(const QString &text) -> void;
+
+            /**
+             * @brief       Returns the text of the ribbon action.
+             *
+             * @returns     the text.
+             */
+            auto text() const -> QString;
+
+            /**
+             * @brief       Binds a widget to the ribbon action, the current state of the action is applied to it.
+             *
+             * @note        A widget is only bound once, it is unbound automatically when it is destroyed.
+             *
+             * @param[in]   widget the widget.
+             */
+            auto addWidget(QWidget *widget) -> void;
+
+            /**
+             * @brief       Unbinds a widget from the ribbon action.
+             *
+             * @param[in]   widget the widget.
+             */
+            auto removeWidget(QWidget *widget) -> void;
+
+            /**
+             * @brief       Applies any pending state changes to the bound widgets immediately.
+             */
+            auto flush() -> void;
+
+            /**
+             * @brief       Returns the number of state changes that did not require a separate widget update.
+             *
+             * @details     This counts changes that set a value the action already had and changes that were
+             *              merged into an update that was already pending.
+             *
+             * @returns     the number of suppressed updates.
+             */
+            auto suppressedUpdates() const -> quint64;
+
+            /**
+             * @brief       Subscribes a handler to events of the given class.
+             *
+             * @code{.cpp}
+             *      action->subscribe<DropButtonClickedEvent>([](const DropButtonClickedEvent &event) {
+             *          ...
+             *      });
+             * @endcode
+             *
+             * @param[in]   handler the function to call when an event of the class is triggered.
+             *
+             * @returns     the subscription id which can be passed to unsubscribe().
+             */
+            template <class EventClass>
+            auto subscribe(const std::function<void(const EventClass &)> &handler) -> int {
+                auto id = ++m_lastSubscriptionId;
+
+                m_subscriptions[static_cast<int>(EventClass::StaticType)].append({id, [handler](const Event &event) {
+                    handler(static_cast<const EventClass &>(event));
+                }});
+
+                return id;
             }
 
             /**
-             * @brief       Emits the ribbonEvent signal with the given event data.
+             * @brief       Removes a subscription.
+             *
+             * @param[in]   id the subscription id returned by subscribe().
+             */
+            auto unsubscribe(int id) -> void;
+
+            /**
+             * @brief       Dispatches the event to the subscribers of its type and emits the ribbonEvent signal.
+             *
+             * @note        The signal is only emitted if it is connected, the event is not copied and is only
+             *              valid for the duration of the call.
              *
              * @param[in]   event the event.
              */
-            virtual auto triggerEvent(Nedrysoft::Ribbon::Event *event) -> void {
-                Q_EMIT ribbonEvent(event);
-            }
+            virtual auto triggerEvent(Nedrysoft::Ribbon::Event *event) -> void;
 
         public:
             /**
@@ -108,10 +309,51 @@ namespace Nedrysoft { namespace Ribbon {
              */
             Q_SIGNAL void ribbonEvent(Nedrysoft::Ribbon::Event *event);
 
+            /**
+             * @brief       Emitted once the pending state changes have been applied to the bound widgets.
+             */
+            Q_SIGNAL void changed();
+
+        private:
+            /**
+             * @brief       The state of the action that is applied to bound widgets.
+             */
+            struct State {
+                bool enabled = true;
+                bool checked = false;
+                bool visible = true;
+                QString text;
+            };
+
+            /**
+             * @brief       Schedules the pending state to be applied on the next pass of the event loop.
+             */
+            auto scheduleFlush() -> void;
+
+            /**
+             * @brief       Applies the values of the state that differ from the state the widget already has.
+             *
+             * @param[in]   widget the widget.
+             * @param[in]   state the state to apply.
+             * @param[in]   appliedState the state that the widget currently has.
+             */
+            static auto applyState(QWidget *widget, const State &state, const State &appliedState) -> void;
+
         private:
             //! @cond
 
-            bool m_enabled;
+            struct Subscription {
+                int id;
+                std::function<void(const Nedrysoft::Ribbon::Event &)> handler;
+            };
+
+            State m_state;
+            State m_appliedState;
+            QVector<QPointer<QWidget>> m_widgets;
+            quint64 m_suppressedUpdates = 0;
+            bool m_flushScheduled = false;
+            int m_lastSubscriptionId = 0;
+            std::array<QVector<Subscription>, static_cast<int>(Nedrysoft::Ribbon::EventType::Count)> m_subscriptions;
 
             //! @endcond
     };
@@ -0,0 +1,656 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonBuilder.h"
+
+#include "RibbonAction.h"
+#include "RibbonButton.h"
+#include "RibbonCheckBox.h"
+#include "RibbonComboBox.h"
+#include "RibbonDropButton.h"
+#include "RibbonGroup.h"
+#include "RibbonLineEdit.h"
+#include "RibbonPushButton.h"
+#include "RibbonSingleLineEdit.h"
+#include "RibbonSlider.h"
+#include "RibbonToolButton.h"
+#include "RibbonWidget.h"
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHBoxLayout>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPointer>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+constexpr quint32 CacheMagic = 0x4e524243;                                      // "NRBC"
+constexpr auto CacheStreamVersion = QDataStream::Qt_5_0;
+
+constexpr const char *ControlTypeNames[] = {
+    "Button",
+    "CheckBox",
+    "ComboBox",
+    "DropButton",
+    "LineEdit",
+    "PushButton",
+    "SingleLineEdit",
+    "Slider",
+    "ToolButton"
+};
+
+static auto sourceTimestamp(const QFileInfo &fileInfo) -> qint64 {
+    auto lastModified = fileInfo.lastModified();
+
+    return lastModified.isValid() ? lastModified.toMSecsSinceEpoch() : 0;
+}
+
+Nedrysoft::Ribbon::RibbonBuilder::RibbonBuilder(QObject *parent) :
+        QObject(parent),
+        m_cacheDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)),
+        m_loadedFromCache(false) {
+
+}
+
+Nedrysoft::Ribbon::RibbonBuilder::~RibbonBuilder() {
+    // actions that have been handed to a ribbon by build() are owned by the ribbon and are not deleted here.
+
+    for (auto &action : m_actions) {
+        if ((action) && (!action->parent())) {
+            delete action;
+        }
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::setCacheDirectory(const QString &directory) -> void {
+    m_cacheDirectory = directory;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::isLoadedFromCache() -> bool {
+    return m_loadedFromCache;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::errorString() -> QString {
+    return m_errorString;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::load(const QString &filename) -> bool {
+    auto cacheFilename = this->cacheFilename(filename);
+
+    m_tabs.clear();
+    m_errorString.clear();
+    m_loadedFromCache = false;
+
+    if ((!cacheFilename.isEmpty()) && (readCache(cacheFilename, filename))) {
+        m_loadedFromCache = true;
+
+        return true;
+    }
+
+    if (!parse(filename)) {
+        m_tabs.clear();
+
+        return false;
+    }
+
+    // failing to write the cache is not an error, the description will be parsed again next time.
+
+    if (!cacheFilename.isEmpty()) {
+        QDir().mkpath(QFileInfo(cacheFilename).absolutePath());
+
+        writeCache(cacheFilename, filename);
+    }
+
+    return true;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::compile(const QString &filename, const QString &cacheFilename) -> bool {
+    m_tabs.clear();
+    m_errorString.clear();
+
+    if (!parse(filename)) {
+        return false;
+    }
+
+    return writeCache(cacheFilename, filename);
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::cacheFilename(const QString &filename) -> QString {
+    if (m_cacheDirectory.isEmpty()) {
+        return QString();
+    }
+
+    auto hash = QCryptographicHash::hash(
+            QFileInfo(filename).absoluteFilePath().toUtf8(),
+            QCryptographicHash::Sha1).toHex();
+
+    return QDir(m_cacheDirectory).filePath(QString("ribbon-%1.rbc").arg(QString::fromLatin1(hash)));
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::parse(const QString &filename) -> bool {
+    QFile file(filename);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_errorString = QString("unable to open %1").arg(filename);
+
+        return false;
+    }
+
+    QJsonParseError parseError;
+
+    auto document = QJsonDocument::fromJson(file.readAll(), &parseError);
+
+    if (parseError.error!=QJsonParseError::NoError) {
+        m_errorString = QString("%1 at offset %2").arg(parseError.errorString()).arg(parseError.offset);
+
+        return false;
+    }
+
+    for (auto tabValue : document.object()["tabs"].toArray()) {
+        auto tabObject = tabValue.toObject();
+        auto tab = TabDefinition{tabObject["title"].toString(), {}};
+
+        for (auto groupValue : tabObject["groups"].toArray()) {
+            auto groupObject = groupValue.toObject();
+            auto group = GroupDefinition{groupObject["name"].toString(), {}};
+
+            for (auto controlValue : groupObject["controls"].toArray()) {
+                ControlDefinition control;
+
+                if (!parseControl(controlValue.toObject(), control)) {
+                    return false;
+                }
+
+                group.controls.append(control);
+            }
+
+            tab.groups.append(group);
+        }
+
+        m_tabs.append(tab);
+    }
+
+    return true;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::parseControl(const QJsonObject &object, ControlDefinition &control) -> bool {
+    auto typeName = object["type"].toString();
+
+    control.type = -1;
+
+    for (auto type = 0; type<ControlTypeCount; type++) {
+        if (typeName==QLatin1String(ControlTypeNames[type])) {
+            control.type = type;
+        }
+    }
+
+    if (control.type<0) {
+        m_errorString = QString("unknown control type \"%1\"").arg(typeName);
+
+        return false;
+    }
+
+    auto iconSize = object["iconSize"].toArray();
+
+    control.name = object["name"].toString();
+    control.text = object["text"].toString();
+    control.icon = object["icon"].toString();
+    control.iconSize = QSize(iconSize.at(0).toInt(), iconSize.at(1).toInt());
+    control.action = object["action"].toString();
+    control.vertical = object["vertical"].toBool(control.type==DropButton);
+    control.checked = object["checked"].toBool(false);
+
+    for (auto itemValue : object["items"].toArray()) {
+        control.items.append(itemValue.toString());
+    }
+
+    return true;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::writeCache(const QString &cacheFilename, const QString &filename) -> bool {
+    QSaveFile file(cacheFilename);
+
+    if (!file.open(QIODevice::WriteOnly)) {
+        m_errorString = QString("unable to write %1").arg(cacheFilename);
+
+        return false;
+    }
+
+    QFileInfo fileInfo(filename);
+    QDataStream stream(&file);
+
+    stream.setVersion(CacheStreamVersion);
+
+    stream << CacheMagic << RibbonBuilderCacheVersion << fileInfo.size() << sourceTimestamp(fileInfo);
+
+    stream << static_cast<qint32>(m_tabs.count());
+
+    for (auto &tab : m_tabs) {
+        stream << tab.title << static_cast<qint32>(tab.groups.count());
+
+        for (auto &group : tab.groups) {
+            stream << group.name << static_cast<qint32>(group.controls.count());
+
+            for (auto &control : group.controls) {
+                stream << control.type
+                       << control.name
+                       << control.text
+                       << control.icon
+                       << control.iconSize
+                       << control.action
+                       << control.items
+                       << control.vertical
+                       << control.checked;
+            }
+        }
+    }
+
+    if (stream.status()!=QDataStream::Ok) {
+        file.cancelWriting();
+
+        return false;
+    }
+
+    return file.commit();
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::readCache(const QString &cacheFilename, const QString &filename) -> bool {
+    QFile file(cacheFilename);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    // the cache is memory mapped and read in place, falling back to reading the file if mapping is not supported.
+
+    QByteArray data;
+
+    auto mappedData = file.map(0, file.size());
+
+    if (mappedData) {
+        data = QByteArray::fromRawData(reinterpret_cast<const char *>(mappedData), static_cast<int>(file.size()));
+    } else {
+        data = file.readAll();
+    }
+
+    QBuffer buffer(&data);
+
+    buffer.open(QIODevice::ReadOnly);
+
+    QDataStream stream(&buffer);
+
+    stream.setVersion(CacheStreamVersion);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint64 sourceSize = -1;
+    qint64 sourceModified = -1;
+
+    stream >> magic >> version >> sourceSize >> sourceModified;
+
+    QFileInfo fileInfo(filename);
+
+    if ((magic!=CacheMagic) ||
+        (version!=RibbonBuilderCacheVersion) ||
+        (sourceSize!=fileInfo.size()) ||
+        (sourceModified!=sourceTimestamp(fileInfo))) {
+
+        return false;
+    }
+
+    qint32 tabCount = 0;
+
+    stream >> tabCount;
+
+    for (auto tabIndex = 0; (tabIndex<tabCount) && (stream.status()==QDataStream::Ok); tabIndex++) {
+        TabDefinition tab;
+        qint32 groupCount = 0;
+
+        stream >> tab.title >> groupCount;
+
+        for (auto groupIndex = 0; (groupIndex<groupCount) && (stream.status()==QDataStream::Ok); groupIndex++) {
+            GroupDefinition group;
+            qint32 controlCount = 0;
+
+            stream >> group.name >> controlCount;
+
+            for (auto controlIndex = 0; controlIndex<controlCount; controlIndex++) {
+                ControlDefinition control;
+
+                if (stream.status()!=QDataStream::Ok) {
+                    break;
+                }
+
+                stream >> control.type
+                       >> control.name
+                       >> control.text
+                       >> control.icon
+                       >> control.iconSize
+                       >> control.action
+                       >> control.items
+                       >> control.vertical
+                       >> control.checked;
+
+                group.controls.append(control);
+            }
+
+            tab.groups.append(group);
+        }
+
+        m_tabs.append(tab);
+    }
+
+    if (mappedData) {
+        file.unmap(mappedData);
+    }
+
+    if (stream.status()!=QDataStream::Ok) {
+        m_tabs.clear();
+
+        return false;
+    }
+
+    return true;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::action(const QString &name) -> Nedrysoft::Ribbon::RibbonAction * {
+    auto iterator = m_actions.constFind(name);
+
+    // an action handed to a ribbon is deleted with the ribbon, in which case a new action is created.
+
+    if ((iterator!=m_actions.constEnd()) && (iterator.value())) {
+        return iterator.value();
+    }
+
+    auto action = new RibbonAction;
+
+    action->setObjectName(name);
+
+    m_actions.insert(name, action);
+
+    return action;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::build(Nedrysoft::Ribbon::RibbonWidget *ribbonWidget) -> void {
+    QPointer<RibbonBuilder> builder(this);
+    ActionMap actions;
+
+    // the actions are created up front and handed to the ribbon so that the pages, which may be created after the
+    // builder has been destroyed, only need the tab definition and the actions captured by their factory.
+
+    for (auto &tab : m_tabs) {
+        for (auto &group : tab.groups) {
+            for (auto &control : group.controls) {
+                if ((!control.action.isEmpty()) && (!actions.contains(control.action))) {
+                    auto action = this->action(control.action);
+
+                    if (!action->parent()) {
+                        action->setParent(ribbonWidget);
+                    }
+
+                    actions.insert(control.action, action);
+                }
+            }
+        }
+    }
+
+    for (auto &tab : m_tabs) {
+        ribbonWidget->addLazyTab(tab.title, [builder, actions, tab]() -> QWidget * {
+            return createPage(tab, actions, builder);
+        });
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::createPage(
+        const TabDefinition &tab,
+        const ActionMap &actions,
+        const QPointer<RibbonBuilder> &builder) -> QWidget * {
+    auto page = new QWidget;
+    auto pageLayout = new QHBoxLayout(page);
+
+    pageLayout->setContentsMargins(0, 0, 0, 0);
+    pageLayout->setSpacing(0);
+
+    for (auto &groupDefinition : tab.groups) {
+        auto group = new RibbonGroup;
+        auto groupLayout = new QHBoxLayout(group);
+
+        group->setGroupName(groupDefinition.name);
+
+        for (auto &controlDefinition : groupDefinition.controls) {
+            auto control = createControl(controlDefinition, actions, builder);
+
+            if (control) {
+                groupLayout->addWidget(control);
+            }
+        }
+
+        pageLayout->addWidget(group);
+    }
+
+    pageLayout->addStretch();
+
+    return page;
+}
+
+auto Nedrysoft::Ribbon::RibbonBuilder::createControl(
+        const ControlDefinition &control,
+        const ActionMap &actions,
+        const QPointer<RibbonBuilder> &builder) -> QWidget * {
+
+    QWidget *widget = nullptr;
+
+    auto icon = control.icon.isEmpty() ? QIcon() : QIcon(control.icon);
+    auto actionName = control.action;
+    auto action = actions.value(actionName);
+
+    auto emitActionTriggered = [builder, actionName]() {
+        if (builder) {
+            Q_EMIT builder->actionTriggered(actionName);
+        }
+    };
+
+    switch(control.type) {
+        case Button: {
+            auto button = new RibbonButton;
+
+            button->setText(control.text);
+            button->setIcon(icon);
+
+            if (control.iconSize.isValid() && !control.iconSize.isEmpty()) {
+                button->setIconSize(control.iconSize);
+            }
+
+            if (!actionName.isEmpty()) {
+                connect(button, &QPushButton::clicked, button, emitActionTriggered);
+            }
+
+            widget = button;
+
+            break;
+        }
+
+        case CheckBox: {
+            auto checkBox = new RibbonCheckBox;
+
+            checkBox->setText(control.text);
+            checkBox->setChecked(control.checked);
+
+            if (!actionName.isEmpty()) {
+                // the checked state is passed back to the action so that the other controls bound to it follow, clicked
+                // is used rather than toggled as the action itself changes the checked state of the check box.
+
+                connect(checkBox, &QCheckBox::clicked, checkBox, [action, emitActionTriggered](bool checked) {
+                    if (action) {
+                        action->setChecked(checked);
+                    }
+
+                    emitActionTriggered();
+                });
+            }
+
+            widget = checkBox;
+
+            break;
+        }
+
+        case ComboBox: {
+            auto comboBox = new RibbonComboBox;
+
+            comboBox->addItems(control.items);
+
+            if (!actionName.isEmpty()) {
+                connect(comboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), comboBox, emitActionTriggered);
+            }
+
+            widget = comboBox;
+
+            break;
+        }
+
+        case DropButton: {
+            auto dropButton = new RibbonDropButton;
+
+            dropButton->setText(control.text);
+            dropButton->setIcon(icon);
+            dropButton->setVertical(control.vertical);
+
+            if (control.iconSize.isValid() && !control.iconSize.isEmpty()) {
+                dropButton->setIconSize(control.iconSize);
+            }
+
+            if (!actionName.isEmpty()) {
+                dropButton->setAction(action);
+
+                connect(dropButton, &RibbonDropButton::clicked, dropButton, emitActionTriggered);
+            }
+
+            widget = dropButton;
+
+            break;
+        }
+
+        case LineEdit: {
+            auto lineEdit = new RibbonLineEdit;
+
+            lineEdit->setPlaceholderText(control.text);
+
+            if (!actionName.isEmpty()) {
+                connect(lineEdit, &QTextEdit::textChanged, lineEdit, emitActionTriggered);
+            }
+
+            widget = lineEdit;
+
+            break;
+        }
+
+        case PushButton: {
+            auto ribbonPushButton = new RibbonPushButton;
+
+            ribbonPushButton->setText(control.text);
+            ribbonPushButton->setIcon(icon);
+
+            if (control.iconSize.isValid() && !control.iconSize.isEmpty()) {
+                ribbonPushButton->setIconSize(control.iconSize);
+            }
+
+            if (!actionName.isEmpty()) {
+                connect(ribbonPushButton, &RibbonPushButton::clicked, ribbonPushButton, emitActionTriggered);
+            }
+
+            widget = ribbonPushButton;
+
+            break;
+        }
+
+        case SingleLineEdit: {
+            auto singleLineEdit = new RibbonSingleLineEdit;
+
+            singleLineEdit->setPlaceholderText(control.text);
+
+            if (!actionName.isEmpty()) {
+                connect(singleLineEdit, &QLineEdit::editingFinished, singleLineEdit, emitActionTriggered);
+            }
+
+            widget = singleLineEdit;
+
+            break;
+        }
+
+        case Slider: {
+            auto slider = new RibbonSlider;
+
+            slider->setOrientation(control.vertical ? Qt::Vertical : Qt::Horizontal);
+
+            if (!actionName.isEmpty()) {
+                connect(slider, &QSlider::valueChanged, slider, emitActionTriggered);
+            }
+
+            widget = slider;
+
+            break;
+        }
+
+        case ToolButton: {
+            auto toolButton = new RibbonToolButton;
+
+            toolButton->setText(control.text);
+            toolButton->setIcon(icon);
+
+            if (control.iconSize.isValid() && !control.iconSize.isEmpty()) {
+                toolButton->setIconSize(control.iconSize);
+            }
+
+            if (!actionName.isEmpty()) {
+                connect(toolButton, &QToolButton::clicked, toolButton, emitActionTriggered);
+            }
+
+            widget = toolButton;
+
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    if (widget) {
+        widget->setObjectName(control.name);
+
+        // the state of the action (enabled, checked, visible and text) is applied to the control.
+
+        if (action) {
+            action->addWidget(widget);
+        }
+    }
+
+    return widget;
+}
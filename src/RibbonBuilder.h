@@ -0,0 +1,309 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONBUILDER_H
+#define NEDRYSOFT_RIBBONBUILDER_H
+
+#include "RibbonSpec.h"
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class QDataStream;
+class QJsonObject;
+
+namespace Nedrysoft { namespace Ribbon {
+    class RibbonAction;
+    class RibbonWidget;
+
+    /**
+     * @brief       The version of the binary ribbon cache format, caches of other versions are discarded.
+     */
+    constexpr quint32 RibbonBuilderCacheVersion = 1;
+
+    /**
+     * @brief       The RibbonBuilder class builds a ribbon from a JSON description.
+     *
+     * @details     The description contains the tabs of the ribbon, the groups on each tab and the controls in
+     *              each group:
+     *
+     * @code{.json}
+     *              {
+     *                  "tabs": [{
+     *                      "title": "Home",
+     *                      "groups": [{
+     *                          "name": "Clipboard",
+     *                          "controls": [
+     *                              { "type": "PushButton", "name": "paste", "text": "Paste",
+     *                                "icon": ":/icons/paste.png", "action": "paste" },
+     *                              { "type": "ComboBox", "items": ["One", "Two"] }
+     *                          ]
+     *                      }]
+     *                  }]
+     *              }
+     * @endcode
+     *
+     *              The control types are Button, CheckBox, ComboBox, DropButton, LineEdit, PushButton,
+     *              SingleLineEdit, Slider and ToolButton, the name of a control is used as its object name.
+     *
+     *              The first time a description is loaded it is compiled to a versioned binary cache, later loads
+     *              of an unchanged description memory map the cache and do not parse the JSON.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonBuilder :
+            public QObject {
+
+        private:
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief       Constructs a new RibbonBuilder which is a child of the parent.
+             *
+             * @param[in]   parent the owner object.
+             */
+            explicit RibbonBuilder(QObject *parent=nullptr);
+
+            /**
+             * @brief       Destroys the RibbonBuilder.
+             */
+            ~RibbonBuilder() override;
+
+            /**
+             * @brief       Sets the folder that compiled descriptions are cached in.
+             *
+             * @note        Defaults to the application cache location, caching is disabled if set to an empty string.
+             *
+             * @param[in]   directory the cache folder.
+             */
+            auto setCacheDirectory(const QString &directory) -> void;
+
+            /**
+             * @brief       Loads a ribbon description, from the binary cache if it is up to date.
+             *
+             * @param[in]   filename the JSON description file.
+             *
+             * @returns     true if the description was loaded; otherwise false, errorString() contains the reason.
+             */
+            auto load(const QString &filename) -> bool;
+
+            /**
+             * @brief       Returns whether the last description was loaded from the binary cache.
+             *
+             * @returns     true if the cache was used; otherwise false.
+             */
+            auto isLoadedFromCache() -> bool;
+
+            /**
+             * @brief       Returns the reason the last load failed.
+             *
+             * @returns     the error message.
+             */
+            auto errorString() -> QString;
+
+            /**
+             * @brief       Adds the tabs of the loaded description to the ribbon.
+             *
+             * @note        The pages are added with RibbonWidget::addLazyTab, so the controls of a tab are only
+             *              created when the tab is first needed.  The pages do not depend on the builder, which
+             *              may be destroyed once build() returns, and the actions used by the description are
+             *              handed to the ribbon which then owns them.
+             *
+             * @param[in]   ribbonWidget the ribbon to add the tabs to.
+             */
+            auto build(Nedrysoft::Ribbon::RibbonWidget *ribbonWidget) -> void;
+
+            /**
+             * @brief       Returns the named action, creating it if required.
+             *
+             * @note        Actions are owned by the builder until build() hands them to the ribbon, the state of
+             *              an action is applied to the controls that use it and drop buttons trigger their action
+             *              directly.
+             *
+             * @param[in]   name the name of the action.
+             *
+             * @returns     the action.
+             */
+            auto action(const QString &name) -> Nedrysoft::Ribbon::RibbonAction *;
+
+            /**
+             * @brief       Compiles a JSON description to a binary cache file.
+             *
+             * @param[in]   filename the JSON description file.
+             * @param[in]   cacheFilename the binary cache file to write.
+             *
+             * @returns     true if the cache was written; otherwise false.
+             */
+            auto compile(const QString &filename, const QString &cacheFilename) -> bool;
+
+        public:
+            /**
+             * @brief       Emitted when a control with an action is clicked or its value changes.
+             *
+             * @note        Buttons and check boxes emit this when clicked, combo boxes when the current index
+             *              changes, line edits when the text changes, single line edits when editing is finished and
+             *              sliders when the value changes.
+             *
+             * @param[in]   name the name of the action.
+             */
+            Q_SIGNAL void actionTriggered(const QString &name);
+
+        private:
+            //! @cond
+
+            enum ControlType {
+                Button = 0,
+                CheckBox,
+                ComboBox,
+                DropButton,
+                LineEdit,
+                PushButton,
+                SingleLineEdit,
+                Slider,
+                ToolButton,
+                ControlTypeCount
+            };
+
+            struct ControlDefinition {
+                qint32 type;
+                QString name;
+                QString text;
+                QString icon;
+                QSize iconSize;
+                QString action;
+                QStringList items;
+                bool vertical;
+                bool checked;
+            };
+
+            struct GroupDefinition {
+                QString name;
+                QVector<ControlDefinition> controls;
+            };
+
+            struct TabDefinition {
+                QString title;
+                QVector<GroupDefinition> groups;
+            };
+
+            using ActionMap = QHash<QString, QPointer<Nedrysoft::Ribbon::RibbonAction>>;
+
+            //! @endcond
+
+            /**
+             * @brief       Parses a JSON description.
+             *
+             * @param[in]   filename the JSON description file.
+             *
+             * @returns     true if the description was parsed; otherwise false.
+             */
+            auto parse(const QString &filename) -> bool;
+
+            /**
+             * @brief       Parses the description of a control.
+             *
+             * @param[in]   object the JSON object describing the control.
+             * @param[out]  control the control definition.
+             *
+             * @returns     true if the control was parsed; otherwise false.
+             */
+            auto parseControl(const QJsonObject &object, ControlDefinition &control) -> bool;
+
+            /**
+             * @brief       Reads a binary cache, the cache is memory mapped where possible.
+             *
+             * @param[in]   cacheFilename the binary cache file.
+             * @param[in]   filename the JSON description file that the cache must match.
+             *
+             * @returns     true if the cache was valid and read; otherwise false.
+             */
+            auto readCache(const QString &cacheFilename, const QString &filename) -> bool;
+
+            /**
+             * @brief       Writes the loaded description to a binary cache.
+             *
+             * @param[in]   cacheFilename the binary cache file.
+             * @param[in]   filename the JSON description file that the cache was compiled from.
+             *
+             * @returns     true if the cache was written; otherwise false.
+             */
+            auto writeCache(const QString &cacheFilename, const QString &filename) -> bool;
+
+            /**
+             * @brief       Returns the cache file for a description.
+             *
+             * @param[in]   filename the JSON description file.
+             *
+             * @returns     the cache file name; otherwise an empty string if caching is disabled.
+             */
+            auto cacheFilename(const QString &filename) -> QString;
+
+            /**
+             * @brief       Creates the page for a tab.
+             *
+             * @note        The builder may have been destroyed by the time a page is created, in which case the
+             *              controls are still created but actionTriggered is no longer emitted.
+             *
+             * @param[in]   tab the tab definition.
+             * @param[in]   actions the actions used by the description.
+             * @param[in]   builder the builder that emits actionTriggered.
+             *
+             * @returns     the page widget.
+             */
+            static auto createPage(
+                    const TabDefinition &tab,
+                    const ActionMap &actions,
+                    const QPointer<RibbonBuilder> &builder) -> QWidget *;
+
+            /**
+             * @brief       Creates a control.
+             *
+             * @param[in]   control the control definition.
+             * @param[in]   actions the actions used by the description.
+             * @param[in]   builder the builder that emits actionTriggered.
+             *
+             * @returns     the control widget; otherwise nullptr if the type is unknown.
+             */
+            static auto createControl(
+                    const ControlDefinition &control,
+                    const ActionMap &actions,
+                    const QPointer<RibbonBuilder> &builder) -> QWidget *;
+
+        private:
+            //! @cond
+
+            QString m_cacheDirectory;
+            QString m_errorString;
+            QVector<TabDefinition> m_tabs;
+            ActionMap m_actions;
+            bool m_loadedFromCache;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONBUILDER_H
@@ -26,6 +26,10 @@
 #include "RibbonButton.h"
 
 #include "RibbonFontManager.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
 #include "RibbonWidget.h"
 
 #include <QApplication>
@@ -54,7 +58,7 @@ Nedrysoft::Ribbon::RibbonButton::RibbonButton(QWidget *parent) :
 
     auto fontManager = RibbonFontManager::getInstance();
 
-    auto font = QFont(fontManager->normalFont(), RibbonButtonDefaultFontSize);
+    auto font = fontManager->font(FontRole::Normal, RibbonButtonDefaultFontSize);
 
     setFont(font);
 
@@ -62,7 +66,9 @@ Nedrysoft::Ribbon::RibbonButton::RibbonButton(QWidget *parent) :
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheets(isDarkMode);
     });
 
@@ -74,29 +80,47 @@ Nedrysoft::Ribbon::RibbonButton::~RibbonButton() {
 }
 
 auto Nedrysoft::Ribbon::RibbonButton::updateStyleSheets(bool isDarkMode) -> void {
-    QString styleSheet(ThemeStylesheet);
-
-    auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
 
-    styleSheet.replace("[background-colour]", themeSupport->getColor(Nedrysoft::Ribbon::PushButtonColor).name());
+    if (RibbonStyle::isActive()) {
+        update();
 
-    if (isDarkMode) {
-        styleSheet.replace("[normal-background-colour]", "#434343");
-    } else {
-        styleSheet.replace("[normal-background-colour]", "#ffffff");
+        return;
     }
 
-    if (isDarkMode) {
-        styleSheet.replace("[hover-colour]", "#4c4c4c");
-    } else {
-        styleSheet.replace("[hover-colour]", "#dddddd");
-    }
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
 
-    if (isDarkMode) {
-        styleSheet.replace("[pressed-colour]", "#292929");
-    } else {
-        styleSheet.replace("[pressed-colour]", "#808080");
-    }
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+
+        styleSheet.replace("[background-colour]", themeSupport->getColor(Nedrysoft::Ribbon::PushButtonColor).name());
+
+        if (isDarkMode) {
+            styleSheet.replace("[normal-background-colour]", "#434343");
+        } else {
+            styleSheet.replace("[normal-background-colour]", "#ffffff");
+        }
+
+        if (isDarkMode) {
+            styleSheet.replace("[hover-colour]", "#4c4c4c");
+        } else {
+            styleSheet.replace("[hover-colour]", "#dddddd");
+        }
+
+        if (isDarkMode) {
+            styleSheet.replace("[pressed-colour]", "#292929");
+        } else {
+            styleSheet.replace("[pressed-colour]", "#808080");
+        }
+
+        return styleSheet;
+    });
 
     setStyleSheet(styleSheet);
 }
@@ -23,6 +23,11 @@
 
 #include "RibbonCheckBox.h"
 
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
+
 #include <QApplication>
 #include <QSpacerItem>
 
@@ -68,7 +73,9 @@ Nedrysoft::Ribbon::RibbonCheckBox::RibbonCheckBox(QWidget *parent) :
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheet(isDarkMode);
     });
 
@@ -80,9 +87,27 @@ Nedrysoft::Ribbon::RibbonCheckBox::~RibbonCheckBox() {
 }
 
 auto Nedrysoft::Ribbon::RibbonCheckBox::updateStyleSheet(bool isDarkMode) -> void {
-    QString styleSheet(ThemeStylesheet);
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
+
+    if (RibbonStyle::isActive()) {
+        update();
+
+        return;
+    }
 
-    styleSheet.replace("[theme]", isDarkMode ? "dark" : "light");
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
+
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        styleSheet.replace("[theme]", isDarkMode ? "dark" : "light");
+
+        return styleSheet;
+    });
 
     setStyleSheet(styleSheet);
 }
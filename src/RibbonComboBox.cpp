@@ -25,8 +25,21 @@
 
 #include "RibbonComboBox.h"
 
+#include "RibbonComboBoxModel.h"
+#include "RibbonComboBoxPreviewDelegate.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
+
+#include <QAbstractItemView>
 #include <QApplication>
+#include <QKeyEvent>
+#include <QListView>
+#include <QPointer>
+#include <QSignalBlocker>
 #include <QSpacerItem>
+#include <QStyledItemDelegate>
 
 constexpr auto ThemeStylesheet = R"(
     QComboBox {
@@ -53,13 +66,18 @@ constexpr auto ThemeStylesheet = R"(
 )";
 
 Nedrysoft::Ribbon::RibbonComboBox::RibbonComboBox(QWidget *parent) :
-        QComboBox(parent) {
+        QComboBox(parent),
+        m_virtualModel(nullptr),
+        m_previewDelegate(nullptr),
+        m_selectedSourceRow(-1) {
 
     setAttribute(Qt::WA_MacShowFocusRect,false);
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheet(isDarkMode);
     });
 
@@ -70,28 +88,269 @@ Nedrysoft::Ribbon::RibbonComboBox::~RibbonComboBox() {
 
 }
 
+auto Nedrysoft::Ribbon::RibbonComboBox::setVirtualItems(const QStringList &items) -> void {
+    if (!m_virtualModel) {
+        m_virtualModel = new RibbonComboBoxModel(this);
+
+        setModel(m_virtualModel);
+    }
+
+    m_virtualModel->setItems(items);
+
+    auto listView = qobject_cast<QListView *>(view());
+
+    if (listView) {
+        listView->setUniformItemSizes(true);
+    }
+
+    setCurrentIndex(items.isEmpty() ? -1 : 0);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::setCurrentSourceRow(int sourceRow) -> void {
+    if ((!m_virtualModel) || (model()!=m_virtualModel)) {
+        setCurrentIndex(sourceRow);
+
+        return;
+    }
+
+    if (m_virtualModel->isFiltered()) {
+        const QSignalBlocker signalBlocker(this);
+
+        m_virtualModel->setFilterText(QString());
+    }
+
+    // when unfiltered the rows of the model are the positions in the list of items, so fetching the row is enough.
+
+    m_virtualModel->ensureFetched(sourceRow);
+
+    m_selectedSourceRow = sourceRow;
+
+    setCurrentIndex(sourceRow);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::findVirtualText(const QString &text) -> int {
+    if ((!m_virtualModel) || (model()!=m_virtualModel)) {
+        return findText(text, Qt::MatchExactly | Qt::MatchCaseSensitive);
+    }
+
+    return m_virtualModel->findItem(text);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::virtualModel() -> Nedrysoft::Ribbon::RibbonComboBoxModel * {
+    return m_virtualModel;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::setPreviewProvider(
+        const QSharedPointer<Nedrysoft::Ribbon::RibbonComboBoxPreviewProvider> &provider,
+        const QSize &size) -> void {
+
+    // Qt 5 deletes the previous delegate when a new one is set but Qt 6 does not, the guarded pointer is cleared
+    // if it has already been deleted.
+
+    QPointer<RibbonComboBoxPreviewDelegate> previousDelegate = m_previewDelegate;
+
+    if (!provider) {
+        if (!previousDelegate) {
+            return;
+        }
+
+        m_previewDelegate = nullptr;
+
+        setItemDelegate(new QStyledItemDelegate(view()));
+    } else {
+        m_previewDelegate = new RibbonComboBoxPreviewDelegate(provider, view());
+
+        m_previewDelegate->setPreviewSize(size);
+
+        setItemDelegate(m_previewDelegate);
+    }
+
+    delete previousDelegate;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::previewDelegate() -> Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate * {
+    return m_previewDelegate;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::showPopup() -> void {
+    if ((m_virtualModel) && (model()==m_virtualModel)) {
+        if (m_virtualModel->isFiltered()) {
+            clearFilter(m_selectedSourceRow);
+        }
+
+        m_selectedSourceRow = currentIndex();
+
+        // the popup installs its own filters on the view, installing ours again puts it in front of them.
+
+        view()->installEventFilter(this);
+        view()->viewport()->installEventFilter(this);
+    }
+
+    QComboBox::showPopup();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::hidePopup() -> void {
+    QComboBox::hidePopup();
+
+    if (m_previewDelegate) {
+        m_previewDelegate->cancelPendingPreviews();
+    }
+
+    // if the popup was closed without choosing an item, the previous selection is restored.
+
+    if ((m_virtualModel) && (m_virtualModel->isFiltered())) {
+        clearFilter(m_selectedSourceRow);
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::eventFilter(QObject *watched, QEvent *event) -> bool {
+    if ((!m_virtualModel) || (model()!=m_virtualModel) || ((watched!=view()) && (watched!=view()->viewport()))) {
+        return QComboBox::eventFilter(watched, event);
+    }
+
+    switch(event->type()) {
+        case QEvent::KeyPress: {
+            auto keyEvent = static_cast<QKeyEvent *>(event);
+
+            switch(keyEvent->key()) {
+                case Qt::Key_Backspace: {
+                    if (m_virtualModel->isFiltered()) {
+                        auto filterText = m_virtualModel->filterText();
+
+                        applyFilter(filterText.left(filterText.length()-1));
+                    }
+
+                    return true;
+                }
+
+                case Qt::Key_Enter:
+                case Qt::Key_Return: {
+                    if ((m_virtualModel->isFiltered()) && (view()->currentIndex().isValid())) {
+                        clearFilter(m_virtualModel->sourceRow(view()->currentIndex().row()));
+                    }
+
+                    break;
+                }
+
+                default: {
+                    auto text = keyEvent->text();
+
+                    if ((text.isEmpty()) ||
+                        (!text.at(0).isPrint()) ||
+                        (keyEvent->modifiers() & (Qt::ControlModifier | Qt::AltModifier | Qt::MetaModifier))) {
+
+                        break;
+                    }
+
+                    applyFilter(m_virtualModel->filterText()+text);
+
+                    return true;
+                }
+            }
+
+            break;
+        }
+
+        case QEvent::MouseButtonRelease: {
+            // the popup selects the current item of the view once this filter returns, so the filter is removed
+            // first and the view is pointed at the same item in the unfiltered list.
+
+            if ((watched==view()->viewport()) &&
+                (m_virtualModel->isFiltered()) &&
+                (view()->currentIndex().isValid())) {
+
+                clearFilter(m_virtualModel->sourceRow(view()->currentIndex().row()));
+            }
+
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    return QComboBox::eventFilter(watched, event);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::applyFilter(const QString &text) -> void {
+    // the model is reset by the filter, signals are blocked so that the intermediate selection is not reported.
+
+    const QSignalBlocker signalBlocker(this);
+
+    m_virtualModel->setFilterText(text);
+
+    // the rows shown before the filter changed may no longer be visible.
+
+    if (m_previewDelegate) {
+        m_previewDelegate->cancelPendingPreviews();
+    }
+
+    if (m_virtualModel->rowCount()) {
+        view()->setCurrentIndex(m_virtualModel->index(0, 0));
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBox::clearFilter(int sourceRow) -> void {
+    const QSignalBlocker signalBlocker(this);
+
+    m_virtualModel->setFilterText(QString());
+
+    // the previous selection is restored first, so that choosing the same item again is not reported as a change.
+
+    m_virtualModel->ensureFetched(qMax(sourceRow, m_selectedSourceRow));
+
+    setCurrentIndex(m_selectedSourceRow);
+
+    if (sourceRow>=0) {
+        view()->setCurrentIndex(m_virtualModel->index(sourceRow, 0));
+    }
+}
+
 auto Nedrysoft::Ribbon::RibbonComboBox::updateStyleSheet(bool isDarkMode) -> void {
-    QString styleSheet(ThemeStylesheet);
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
+
+    if (RibbonStyle::isActive()) {
+        update();
+
+        return;
+    }
 
 #if defined(Q_OS_MACOS)
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
-    
-    styleSheet.replace("[selected-background-colour]", themeSupport->getHighlightedBackground().name());
+
+    auto selectedBackgroundColour = themeSupport->getHighlightedBackground().name();
 #else
-    styleSheet.replace("[selected-background-colour]", this->palette().highlight().color().name());
+    auto selectedBackgroundColour = this->palette().highlight().color().name();
 #endif
-    styleSheet.replace("[theme]", isDarkMode ? "dark" : "light");
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
 
-    if (isDarkMode) {
-        styleSheet.replace("[background-colour]", "#434343");
-        styleSheet.replace("[border-colour]", "#323232");
-        styleSheet.replace("[hover-background-colour]", "#626262");
+    // the selection colour comes from the platform, so it forms part of the key.
 
-    } else {
-        styleSheet.replace("[background-colour]", "#ffffff");
-        styleSheet.replace("[border-colour]", "#B9B9B9");
-        styleSheet.replace("[hover-background-colour]", "#f5f5f5");
-    }
+    auto styleSheet = styleSheetCache->styleSheet(
+            QString("%1:%2").arg(staticMetaObject.className()).arg(selectedBackgroundColour),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode, selectedBackgroundColour]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        styleSheet.replace("[selected-background-colour]", selectedBackgroundColour);
+
+        styleSheet.replace("[theme]", isDarkMode ? "dark" : "light");
+
+        if (isDarkMode) {
+            styleSheet.replace("[background-colour]", "#434343");
+            styleSheet.replace("[border-colour]", "#323232");
+            styleSheet.replace("[hover-background-colour]", "#626262");
+
+        } else {
+            styleSheet.replace("[background-colour]", "#ffffff");
+            styleSheet.replace("[border-colour]", "#B9B9B9");
+            styleSheet.replace("[hover-background-colour]", "#f5f5f5");
+        }
+
+        return styleSheet;
+    });
 
     setStyleSheet(styleSheet);
 }
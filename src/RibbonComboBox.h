@@ -27,9 +27,14 @@
 #include "RibbonSpec.h"
 
 #include <QComboBox>
+#include <QSharedPointer>
 #include <ThemeSupport>
 
 namespace Nedrysoft { namespace Ribbon {
+    class RibbonComboBoxModel;
+    class RibbonComboBoxPreviewDelegate;
+    class RibbonComboBoxPreviewProvider;
+
     /**
      * @brief       The RibbonComboBox widget provides a ribbon stylised check box.
      *
@@ -54,6 +59,91 @@ namespace Nedrysoft { namespace Ribbon {
              */
             ~RibbonComboBox() override;
 
+            /**
+             * @brief       Replaces the items of the combo box with a virtualised list.
+             *
+             * @details     The items are held in a RibbonComboBoxModel, which only creates rows as the popup is
+             *              scrolled, and the popup is configured for uniform item sizes.  While the popup is open,
+             *              typing filters the list to the items that start with the typed text and backspace removes
+             *              the last character of the filter.
+             *
+             *              Only the rows that have been fetched exist in the combo box, so items are selected with
+             *              setCurrentSourceRow() and found with findVirtualText() rather than setCurrentIndex(),
+             *              setCurrentText() and findText(), which only see the fetched rows.
+             *
+             * @note        Once the virtual model is installed, addItem(), insertItem() and the other item functions
+             *              of QComboBox no longer work, the items can only be replaced with setVirtualItems().
+             *
+             * @param[in]   items the items.
+             */
+            auto setVirtualItems(const QStringList &items) -> void;
+
+            /**
+             * @brief       Selects an item, fetching it first if it is part of a virtual list.
+             *
+             * @param[in]   sourceRow the position of the item in the list of items; or -1 to clear the selection.
+             */
+            auto setCurrentSourceRow(int sourceRow) -> void;
+
+            /**
+             * @brief       Finds an item, including virtual items that have not been fetched.
+             *
+             * @param[in]   text the text of the item, the comparison is case sensitive.
+             *
+             * @returns     the position of the item in the list of items; or -1 if not found.
+             */
+            auto findVirtualText(const QString &text) -> int;
+
+            /**
+             * @brief       Returns the model used for virtual items.
+             *
+             * @returns     the model; or nullptr if setVirtualItems has not been called.
+             */
+            auto virtualModel() -> Nedrysoft::Ribbon::RibbonComboBoxModel *;
+
+            /**
+             * @brief       Sets the provider that renders a preview for each item in the popup.
+             *
+             * @details     The previews are rendered on a worker thread by a RibbonComboBoxPreviewDelegate which
+             *              replaces the item delegate of the popup, a placeholder is shown until each preview is ready.
+             *
+             * @param[in]   provider the preview provider; or a null pointer to remove the previews.
+             * @param[in]   size the size of the previews in device independent pixels.
+             */
+            auto setPreviewProvider(
+                    const QSharedPointer<Nedrysoft::Ribbon::RibbonComboBoxPreviewProvider> &provider,
+                    const QSize &size) -> void;
+
+            /**
+             * @brief       Returns the delegate that draws the previews.
+             *
+             * @returns     the delegate; or nullptr if there is no preview provider.
+             */
+            auto previewDelegate() -> Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate *;
+
+            /**
+             * @brief       Reimplements: QComboBox::showPopup().
+             */
+            auto showPopup() -> void override;
+
+            /**
+             * @brief       Reimplements: QComboBox::hidePopup().
+             */
+            auto hidePopup() -> void override;
+
+        protected:
+            /**
+             * @brief       Reimplements: QObject::eventFilter(QObject *watched, QEvent *event).
+             *
+             * @note        Used to filter the popup as the user types.
+             *
+             * @param[in]   watched the object that caused the event.
+             * @param[in]   event the event information.
+             *
+             * @returns     true if the event was handled; otherwise false.
+             */
+            auto eventFilter(QObject *watched, QEvent *event) -> bool override;
+
         private:
             /**
              * @brief       Updates the stylesheet when the operating system theme is changed.
@@ -61,6 +151,29 @@ namespace Nedrysoft { namespace Ribbon {
              * @param[in]   isDarkMode true if dark mode; otherwise false.
              */
             auto updateStyleSheet(bool isDarkMode) -> void;
+
+            /**
+             * @brief       Filters the virtual items and selects the first match in the popup.
+             *
+             * @param[in]   text the filter prefix.
+             */
+            auto applyFilter(const QString &text) -> void;
+
+            /**
+             * @brief       Removes the filter and selects the item in the original list.
+             *
+             * @param[in]   sourceRow the position of the item to select in the original list.
+             */
+            auto clearFilter(int sourceRow) -> void;
+
+        private:
+            //! @cond
+
+            Nedrysoft::Ribbon::RibbonComboBoxModel *m_virtualModel;
+            Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate *m_previewDelegate;
+            int m_selectedSourceRow;
+
+            //! @endcond
     };
 }}
 
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonComboBoxModel.h"
+
+#include <algorithm>
+
+Nedrysoft::Ribbon::RibbonComboBoxModel::RibbonComboBoxModel(QObject *parent) :
+        QAbstractListModel(parent),
+        m_filterBegin(0),
+        m_filterEnd(0),
+        m_fetchedCount(0) {
+
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::setItems(const QStringList &items) -> void {
+    beginResetModel();
+
+    m_items = items;
+    m_foldedItems.clear();
+    m_sortedRows.resize(m_items.count());
+
+    for (auto row = 0; row<m_items.count(); row++) {
+        m_foldedItems.append(m_items.at(row).toCaseFolded());
+        m_sortedRows[row] = row;
+    }
+
+    // the prefix index is a list of rows ordered by their case folded text, items sharing a prefix are adjacent.
+
+    std::stable_sort(m_sortedRows.begin(), m_sortedRows.end(), [this](int left, int right) {
+        return m_foldedItems.at(left)<m_foldedItems.at(right);
+    });
+
+    m_filterText.clear();
+    m_filterBegin = 0;
+    m_filterEnd = m_items.count();
+    m_fetchedCount = qMin(RibbonComboBoxModelFetchSize, m_items.count());
+
+    endResetModel();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::items() const -> QStringList {
+    return m_items;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::setFilterText(const QString &text) -> void {
+    if (text==m_filterText) {
+        return;
+    }
+
+    auto prefix = text.toCaseFolded();
+
+    // when the prefix is extended, the new matches are a subset of the current matches.
+
+    auto begin = m_sortedRows.begin();
+    auto end = m_sortedRows.end();
+
+    if ((!m_filterText.isEmpty()) && (prefix.startsWith(m_filterText.toCaseFolded()))) {
+        begin += m_filterBegin;
+        end = m_sortedRows.begin()+m_filterEnd;
+    }
+
+    beginResetModel();
+
+    m_filterText = text;
+
+    if (prefix.isEmpty()) {
+        m_filterBegin = 0;
+        m_filterEnd = m_items.count();
+    } else {
+        auto first = std::lower_bound(begin, end, prefix, [this](int row, const QString &value) {
+            return m_foldedItems.at(row)<value;
+        });
+
+        auto last = std::upper_bound(first, end, prefix, [this](const QString &value, int row) {
+            return value<m_foldedItems.at(row).left(value.length());
+        });
+
+        m_filterBegin = static_cast<int>(first-m_sortedRows.begin());
+        m_filterEnd = static_cast<int>(last-m_sortedRows.begin());
+    }
+
+    m_fetchedCount = qMin(RibbonComboBoxModelFetchSize, matchCount());
+
+    endResetModel();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::filterText() const -> QString {
+    return m_filterText;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::isFiltered() const -> bool {
+    return !m_filterText.isEmpty();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::sourceRow(int row) const -> int {
+    if ((row<0) || (row>=matchCount())) {
+        return -1;
+    }
+
+    if (!isFiltered()) {
+        return row;
+    }
+
+    return m_sortedRows.at(m_filterBegin+row);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::findItem(const QString &text) const -> int {
+    auto foldedText = text.toCaseFolded();
+
+    auto end = m_sortedRows.end();
+
+    auto first = std::lower_bound(m_sortedRows.begin(), end, foldedText, [this](int row, const QString &value) {
+        return m_foldedItems.at(row)<value;
+    });
+
+    // items that only differ by case are adjacent in the index and, as the sort is stable, in their original order.
+
+    for (auto iterator = first; (iterator!=end) && (m_foldedItems.at(*iterator)==foldedText); iterator++) {
+        if (m_items.at(*iterator)==text) {
+            return *iterator;
+        }
+    }
+
+    return -1;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::ensureFetched(int row) -> void {
+    if ((row<m_fetchedCount) || (row>=matchCount())) {
+        return;
+    }
+
+    // round up to a whole batch so that a view scrolled to the row has rows beyond it.
+
+    auto fetchedCount = qMin(((row/RibbonComboBoxModelFetchSize)+1)*RibbonComboBoxModelFetchSize, matchCount());
+
+    beginInsertRows(QModelIndex(), m_fetchedCount, fetchedCount-1);
+
+    m_fetchedCount = fetchedCount;
+
+    endInsertRows();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::rowCount(const QModelIndex &parent) const -> int {
+    if (parent.isValid()) {
+        return 0;
+    }
+
+    return m_fetchedCount;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::data(const QModelIndex &index, int role) const -> QVariant {
+    if ((!index.isValid()) || (index.row()>=m_fetchedCount)) {
+        return QVariant();
+    }
+
+    switch(role) {
+        case Qt::DisplayRole:
+        case Qt::EditRole: {
+            return m_items.at(sourceRow(index.row()));
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    return QVariant();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::canFetchMore(const QModelIndex &parent) const -> bool {
+    if (parent.isValid()) {
+        return false;
+    }
+
+    return m_fetchedCount<matchCount();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::fetchMore(const QModelIndex &parent) -> void {
+    if (parent.isValid()) {
+        return;
+    }
+
+    ensureFetched(m_fetchedCount);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxModel::matchCount() const -> int {
+    return m_filterEnd-m_filterBegin;
+}
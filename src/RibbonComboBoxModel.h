@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONCOMBOBOXMODEL_H
+#define NEDRYSOFT_RIBBONCOMBOBOXMODEL_H
+
+#include "RibbonSpec.h"
+
+#include <QAbstractListModel>
+#include <QStringList>
+#include <QVector>
+
+namespace Nedrysoft { namespace Ribbon {
+    constexpr auto RibbonComboBoxModelFetchSize = 256;
+
+    /**
+     * @brief       The RibbonComboBoxModel provides a lazily populated, prefix filterable list of strings.
+     *
+     * @details     The model exposes its items in batches as the view scrolls (canFetchMore/fetchMore), so a view
+     *              onto a very large list only creates rows for the items that have been scrolled into view.  A
+     *              case insensitive sorted index of the items is built when the items are set, a prefix filter is
+     *              then a binary search of the index and the matching items are a contiguous range of it, so
+     *              filtering does not depend on the number of items.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonComboBoxModel :
+            public QAbstractListModel {
+
+        private:
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief       Constructs a new RibbonComboBoxModel which is a child of the parent.
+             *
+             * @param[in]   parent the owner object.
+             */
+            explicit RibbonComboBoxModel(QObject *parent=nullptr);
+
+            /**
+             * @brief       Sets the items of the model and builds the prefix index.
+             *
+             * @note        The filter is cleared.
+             *
+             * @param[in]   items the items.
+             */
+            auto setItems(const QStringList &items) -> void;
+
+            /**
+             * @brief       Returns the items of the model, in their original order.
+             *
+             * @returns     the items.
+             */
+            auto items() const -> QStringList;
+
+            /**
+             * @brief       Filters the model to the items that start with the text.
+             *
+             * @note        The comparison is case insensitive and, when unfiltered, the items are in their original
+             *              order; when filtered, the matching items are in sorted order.
+             *
+             * @param[in]   text the prefix; or an empty string to remove the filter.
+             */
+            auto setFilterText(const QString &text) -> void;
+
+            /**
+             * @brief       Returns the current filter prefix.
+             *
+             * @returns     the prefix.
+             */
+            auto filterText() const -> QString;
+
+            /**
+             * @brief       Returns whether a filter is applied.
+             *
+             * @returns     true if filtered; otherwise false.
+             */
+            auto isFiltered() const -> bool;
+
+            /**
+             * @brief       Returns the position of the item in the original list of items.
+             *
+             * @param[in]   row the row in the model.
+             *
+             * @returns     the position of the item; or -1 if the row is not valid.
+             */
+            auto sourceRow(int row) const -> int;
+
+            /**
+             * @brief       Finds an item using the prefix index.
+             *
+             * @note        The comparison is case sensitive, if the text occurs more than once the first occurrence
+             *              is returned.
+             *
+             * @param[in]   text the text of the item.
+             *
+             * @returns     the position of the item in the original list of items; or -1 if not found.
+             */
+            auto findItem(const QString &text) const -> int;
+
+            /**
+             * @brief       Ensures that the given row has been fetched.
+             *
+             * @param[in]   row the row.
+             */
+            auto ensureFetched(int row) -> void;
+
+            /**
+             * @brief       Reimplements: QAbstractItemModel::rowCount(const QModelIndex &parent).
+             *
+             * @param[in]   parent the parent index.
+             *
+             * @returns     the number of rows that have been fetched.
+             */
+            auto rowCount(const QModelIndex &parent = QModelIndex()) const -> int override;
+
+            /**
+             * @brief       Reimplements: QAbstractItemModel::data(const QModelIndex &index, int role).
+             *
+             * @param[in]   index the index of the item.
+             * @param[in]   role the data role.
+             *
+             * @returns     the data.
+             */
+            auto data(const QModelIndex &index, int role = Qt::DisplayRole) const -> QVariant override;
+
+            /**
+             * @brief       Reimplements: QAbstractItemModel::canFetchMore(const QModelIndex &parent).
+             *
+             * @param[in]   parent the parent index.
+             *
+             * @returns     true if there are rows that have not been fetched; otherwise false.
+             */
+            auto canFetchMore(const QModelIndex &parent) const -> bool override;
+
+            /**
+             * @brief       Reimplements: QAbstractItemModel::fetchMore(const QModelIndex &parent).
+             *
+             * @param[in]   parent the parent index.
+             */
+            auto fetchMore(const QModelIndex &parent) -> void override;
+
+        private:
+            /**
+             * @brief       Returns the number of items that match the filter.
+             *
+             * @returns     the number of matching items.
+             */
+            auto matchCount() const -> int;
+
+        private:
+            //! @cond
+
+            QStringList m_items;
+            QStringList m_foldedItems;
+            QVector<int> m_sortedRows;
+            QString m_filterText;
+            int m_filterBegin;
+            int m_filterEnd;
+            int m_fetchedCount;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONCOMBOBOXMODEL_H
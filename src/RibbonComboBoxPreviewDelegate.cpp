@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonComboBoxPreviewDelegate.h"
+
+#include <QAbstractItemView>
+#include <QApplication>
+#include <QPainter>
+#include <QRunnable>
+#include <QScrollBar>
+#include <QStyle>
+
+constexpr auto PlaceholderAlpha = 64;
+
+/**
+ * @brief       Renders a single preview on the thread pool of the delegate.
+ */
+class PreviewRunnable :
+        public QRunnable {
+
+    public:
+        PreviewRunnable(
+                Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate *delegate,
+                const QSharedPointer<Nedrysoft::Ribbon::RibbonComboBoxPreviewProvider> &provider,
+                const QString &key,
+                const QString &text,
+                const QSize &size,
+                qreal devicePixelRatio) :
+
+                m_delegate(delegate),
+                m_provider(provider),
+                m_key(key),
+                m_text(text),
+                m_size(size),
+                m_devicePixelRatio(devicePixelRatio) {
+
+        }
+
+        auto run() -> void override {
+            auto image = m_provider->preview(m_text, m_size, m_devicePixelRatio);
+
+            image.setDevicePixelRatio(m_devicePixelRatio);
+
+            // the delegate waits for its thread pool before it is destroyed, so it is still valid here.
+
+            Q_EMIT m_delegate->previewRendered(m_key, image);
+        }
+
+    private:
+        Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate *m_delegate;
+        QSharedPointer<Nedrysoft::Ribbon::RibbonComboBoxPreviewProvider> m_provider;
+        QString m_key;
+        QString m_text;
+        QSize m_size;
+        qreal m_devicePixelRatio;
+};
+
+Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::RibbonComboBoxPreviewDelegate(
+        const QSharedPointer<Nedrysoft::Ribbon::RibbonComboBoxPreviewProvider> &provider,
+        QObject *parent) :
+
+        QStyledItemDelegate(parent),
+        m_provider(provider),
+        m_previewSize(QSize(RibbonComboBoxPreviewDefaultWidth, RibbonComboBoxPreviewDefaultHeight)),
+        m_requestCount(0) {
+
+    m_previews.setMaxCost(RibbonComboBoxPreviewDefaultCacheSize);
+
+    connect(this, &RibbonComboBoxPreviewDelegate::previewRendered, this, [=](const QString &key, const QImage &image) {
+        storePreview(key, image);
+    }, Qt::QueuedConnection);
+
+    auto view = qobject_cast<QAbstractItemView *>(parent);
+
+    if (view) {
+        connect(view->verticalScrollBar(), &QScrollBar::valueChanged, this, [=]() {
+            cancelPendingPreviews();
+        });
+    }
+}
+
+Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::~RibbonComboBoxPreviewDelegate() {
+    m_threadPool.clear();
+    m_threadPool.waitForDone();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::setPreviewSize(const QSize &size) -> void {
+    m_previewSize = size;
+
+    m_previews.clear();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::previewSize() const -> QSize {
+    return m_previewSize;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::setCacheSize(int kilobytes) -> void {
+    m_previews.setMaxCost(kilobytes);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::threadPool() -> QThreadPool * {
+    return &m_threadPool;
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::cancelPendingPreviews() -> void {
+    // the queued requests are discarded, previews that are already being rendered are still stored when they finish
+    // but may be requested again by a repaint before then.
+
+    m_threadPool.clear();
+
+    m_pendingPreviews.clear();
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::paint(
+        QPainter *painter,
+        const QStyleOptionViewItem &option,
+        const QModelIndex &index) const -> void {
+
+    QStyleOptionViewItem itemOption(option);
+
+    initStyleOption(&itemOption, index);
+
+    // the style reserves the space for the preview, which is then drawn over the (empty) decoration.
+
+    itemOption.features |= QStyleOptionViewItem::HasDecoration;
+    itemOption.decorationSize = m_previewSize;
+    itemOption.icon = QIcon();
+
+    auto widget = option.widget;
+    auto style = widget ? widget->style() : QApplication::style();
+
+    style->drawControl(QStyle::CE_ItemViewItem, &itemOption, painter, widget);
+
+    auto previewRect = style->subElementRect(QStyle::SE_ItemViewItemDecoration, &itemOption, widget);
+    auto devicePixelRatio = widget ? widget->devicePixelRatioF() : qApp->devicePixelRatio();
+
+    auto key = QString("%1:%2x%3:%4")
+            .arg(itemOption.text)
+            .arg(m_previewSize.width())
+            .arg(m_previewSize.height())
+            .arg(devicePixelRatio);
+
+    auto preview = m_previews.object(key);
+
+    if (preview) {
+        if (!preview->isNull()) {
+            painter->drawPixmap(previewRect, *preview);
+        }
+
+        return;
+    }
+
+    auto placeholderColor = option.palette.color(QPalette::Mid);
+
+    placeholderColor.setAlpha(PlaceholderAlpha);
+
+    painter->fillRect(previewRect, placeholderColor);
+
+    requestPreview(key, itemOption.text, devicePixelRatio);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::sizeHint(
+        const QStyleOptionViewItem &option,
+        const QModelIndex &index) const -> QSize {
+
+    QStyleOptionViewItem itemOption(option);
+
+    initStyleOption(&itemOption, index);
+
+    itemOption.features |= QStyleOptionViewItem::HasDecoration;
+    itemOption.decorationSize = m_previewSize;
+
+    auto widget = option.widget;
+    auto style = widget ? widget->style() : QApplication::style();
+
+    return style->sizeFromContents(QStyle::CT_ItemViewItem, &itemOption, QSize(), widget);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::requestPreview(
+        const QString &key,
+        const QString &text,
+        qreal devicePixelRatio) const -> void {
+
+    if ((!m_provider) || (m_pendingPreviews.contains(key))) {
+        return;
+    }
+
+    m_pendingPreviews.insert(key);
+
+    // later requests have a higher priority, so the rows that were painted most recently are rendered first.
+
+    m_threadPool.start(
+            new PreviewRunnable(
+                    const_cast<RibbonComboBoxPreviewDelegate *>(this),
+                    m_provider,
+                    key,
+                    text,
+                    m_previewSize,
+                    devicePixelRatio),
+            ++m_requestCount);
+}
+
+auto Nedrysoft::Ribbon::RibbonComboBoxPreviewDelegate::storePreview(const QString &key, const QImage &image) -> void {
+    m_pendingPreviews.remove(key);
+
+    if (image.isNull()) {
+        m_previews.insert(key, new QPixmap, 1);
+
+        return;
+    }
+
+    auto cost = qMax(1, static_cast<int>(image.sizeInBytes()/1024));
+
+    m_previews.insert(key, new QPixmap(QPixmap::fromImage(image)), cost);
+
+    auto view = qobject_cast<QAbstractItemView *>(parent());
+
+    if (view) {
+        view->viewport()->update();
+    }
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONCOMBOBOXPREVIEWDELEGATE_H
+#define NEDRYSOFT_RIBBONCOMBOBOXPREVIEWDELEGATE_H
+
+#include "RibbonSpec.h"
+
+#include <QCache>
+#include <QImage>
+#include <QPixmap>
+#include <QSet>
+#include <QSharedPointer>
+#include <QStyledItemDelegate>
+#include <QThreadPool>
+
+namespace Nedrysoft { namespace Ribbon {
+    constexpr auto RibbonComboBoxPreviewDefaultWidth = 48;
+    constexpr auto RibbonComboBoxPreviewDefaultHeight = 16;
+    constexpr auto RibbonComboBoxPreviewDefaultCacheSize = 8192;
+
+    /**
+     * @brief       The RibbonComboBoxPreviewProvider class is the interface for objects that render item previews.
+     *
+     * @note        preview() is called on a worker thread, so implementations must not access widgets and must be
+     *              safe to call from several threads at once.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonComboBoxPreviewProvider {
+        public:
+            /**
+             * @brief       Destroys the RibbonComboBoxPreviewProvider.
+             */
+            virtual ~RibbonComboBoxPreviewProvider() = default;
+
+            /**
+             * @brief       Renders the preview of an item.
+             *
+             * @param[in]   text the display text of the item.
+             * @param[in]   size the size of the preview in device independent pixels.
+             * @param[in]   devicePixelRatio the device pixel ratio that the preview will be drawn at.
+             *
+             * @returns     the preview image.
+             */
+            virtual auto preview(const QString &text, const QSize &size, qreal devicePixelRatio) const -> QImage = 0;
+    };
+
+    /**
+     * @brief       The RibbonComboBoxPreviewDelegate draws a preview image alongside each item of a combo box popup.
+     *
+     * @details     Previews are rendered by a RibbonComboBoxPreviewProvider on a thread pool that is owned by the
+     *              delegate, painting never waits for a preview; a placeholder is drawn until the preview is ready
+     *              and the view is then repainted.  The most recently requested previews are rendered first and
+     *              rendered previews are kept in a cache that discards the least recently used previews once its
+     *              size limit is reached.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonComboBoxPreviewDelegate :
+            public QStyledItemDelegate {
+
+        private:
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief       Constructs a new RibbonComboBoxPreviewDelegate which is a child of the parent.
+             *
+             * @param[in]   provider the provider that renders the previews.
+             * @param[in]   parent the owner object, normally the view that the delegate is used by.
+             */
+            explicit RibbonComboBoxPreviewDelegate(
+                    const QSharedPointer<Nedrysoft::Ribbon::RibbonComboBoxPreviewProvider> &provider,
+                    QObject *parent=nullptr);
+
+            /**
+             * @brief       Destroys the RibbonComboBoxPreviewDelegate.
+             *
+             * @note        Waits for any previews that are being rendered to finish.
+             */
+            ~RibbonComboBoxPreviewDelegate() override;
+
+            /**
+             * @brief       Sets the size of the previews.
+             *
+             * @note        Previews that have already been rendered at another size are discarded.
+             *
+             * @param[in]   size the size in device independent pixels.
+             */
+            auto setPreviewSize(const QSize &size) -> void;
+
+            /**
+             * @brief       Returns the size of the previews.
+             *
+             * @returns     the size in device independent pixels.
+             */
+            auto previewSize() const -> QSize;
+
+            /**
+             * @brief       Sets the maximum amount of memory used by rendered previews.
+             *
+             * @param[in]   kilobytes the size of the cache in kilobytes.
+             */
+            auto setCacheSize(int kilobytes) -> void;
+
+            /**
+             * @brief       Returns the thread pool that previews are rendered on.
+             *
+             * @returns     the thread pool.
+             */
+            auto threadPool() -> QThreadPool *;
+
+            /**
+             * @brief       Discards the preview requests that have not started rendering.
+             *
+             * @note        Called when the view is scrolled, the rows that are still visible request their previews
+             *              again when they are repainted.
+             */
+            auto cancelPendingPreviews() -> void;
+
+            /**
+             * @brief       Reimplements: QStyledItemDelegate::paint(QPainter *painter,
+             *              const QStyleOptionViewItem &option, const QModelIndex &index).
+             *
+             * @param[in]   painter the painter to draw with.
+             * @param[in]   option the style options of the item.
+             * @param[in]   index the index of the item.
+             */
+            auto paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+                    -> void override;
+
+            /**
+             * @brief       Reimplements: QStyledItemDelegate::sizeHint(const QStyleOptionViewItem &option,
+             *              const QModelIndex &index).
+             *
+             * @param[in]   option the style options of the item.
+             * @param[in]   index the index of the item.
+             *
+             * @returns     the size of the item.
+             */
+            auto sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const -> QSize override;
+
+        private:
+            /**
+             * @brief       Queues the preview to be rendered if it is not already being rendered.
+             *
+             * @param[in]   key the cache key of the preview.
+             * @param[in]   text the display text of the item.
+             * @param[in]   devicePixelRatio the device pixel ratio that the preview will be drawn at.
+             */
+            auto requestPreview(const QString &key, const QString &text, qreal devicePixelRatio) const -> void;
+
+            /**
+             * @brief       Stores a rendered preview and repaints the view.
+             *
+             * @note        A null image is stored as a null pixmap so that a preview the provider could not render
+             *              is not requested again.
+             *
+             * @param[in]   key the cache key of the preview.
+             * @param[in]   image the rendered preview.
+             */
+            auto storePreview(const QString &key, const QImage &image) -> void;
+
+        public:
+            /**
+             * @brief       Emitted from a worker thread when a preview has been rendered.
+             *
+             * @param[in]   key the cache key of the preview.
+             * @param[in]   image the rendered preview.
+             */
+            Q_SIGNAL void previewRendered(const QString &key, const QImage &image);
+
+        private:
+            //! @cond
+
+            QSharedPointer<Nedrysoft::Ribbon::RibbonComboBoxPreviewProvider> m_provider;
+            QSize m_previewSize;
+            mutable QCache<QString, QPixmap> m_previews;
+            mutable QSet<QString> m_pendingPreviews;
+            mutable QThreadPool m_threadPool;
+            mutable int m_requestCount;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONCOMBOBOXPREVIEWDELEGATE_H
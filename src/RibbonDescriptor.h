@@ -0,0 +1,403 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONDESCRIPTOR_H
+#define NEDRYSOFT_RIBBONDESCRIPTOR_H
+
+#include "RibbonButton.h"
+#include "RibbonCheckBox.h"
+#include "RibbonComboBox.h"
+#include "RibbonDropButton.h"
+#include "RibbonGroup.h"
+#include "RibbonLineEdit.h"
+#include "RibbonPushButton.h"
+#include "RibbonSingleLineEdit.h"
+#include "RibbonSlider.h"
+#include "RibbonToolButton.h"
+#include "RibbonWidget.h"
+
+#include <QHBoxLayout>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief       Compile time ribbon descriptors.
+ *
+ * @details     Describes a ribbon that is fixed at build time as constexpr data, the description is turned into
+ *              construction code by the compiler so there is nothing to parse at runtime:
+ *
+ * @code{.cpp}
+ *              using namespace Nedrysoft::Ribbon::Descriptor;
+ *
+ *              constexpr auto ribbon = Ribbon(
+ *                  Tab("Home",
+ *                      Group("Clipboard",
+ *                          PushButton{"paste", "Paste", ":/icons/paste.png"},
+ *                          DropButton{"copy", "Copy", ":/icons/copy.png"}),
+ *                      Group("Font",
+ *                          ComboBox("fontSize", "8", "10", "12"),
+ *                          CheckBox{"bold", "Bold"})));
+ *
+ *              build(ribbonWidget, ribbon);
+ * @endcode
+ *
+ *              The name of each control is used as its object name.
+ */
+namespace Nedrysoft { namespace Ribbon { namespace Descriptor {
+    /**
+     * @brief       Describes a RibbonButton.
+     */
+    struct Button {
+        const char *name;
+        const char *text;
+        const char *icon = nullptr;
+        int iconWidth = RibbonButtonDefaultIconWidth;
+        int iconHeight = RibbonButtonDefaultIconHeight;
+    };
+
+    /**
+     * @brief       Describes a RibbonCheckBox.
+     */
+    struct CheckBox {
+        const char *name;
+        const char *text;
+        bool checked = false;
+    };
+
+    /**
+     * @brief       Describes a RibbonComboBox and its items.
+     */
+    template <std::size_t ItemCount>
+    struct ComboBox {
+        template <class... Items>
+        constexpr ComboBox(const char *name, Items... items) :
+                name(name),
+                items{items...} {
+
+        }
+
+        const char *name;
+        std::array<const char *, ItemCount> items;
+    };
+
+    template <class... Items>
+    ComboBox(const char *, Items...) -> ComboBox<sizeof...(Items)>;
+
+    /**
+     * @brief       Describes a RibbonDropButton.
+     */
+    struct DropButton {
+        const char *name;
+        const char *text;
+        const char *icon = nullptr;
+        bool vertical = true;
+        int iconWidth = RibbonDropButtonDefaultIconWidth;
+        int iconHeight = RibbonDropButtonDefaultIconHeight;
+    };
+
+    /**
+     * @brief       Describes a RibbonLineEdit.
+     */
+    struct LineEdit {
+        const char *name;
+        const char *placeholderText = nullptr;
+    };
+
+    /**
+     * @brief       Describes a RibbonPushButton.
+     */
+    struct PushButton {
+        const char *name;
+        const char *text;
+        const char *icon = nullptr;
+        int iconWidth = RibbonPushButtonDefaultIconWidth;
+        int iconHeight = RibbonPushButtonDefaultIconHeight;
+    };
+
+    /**
+     * @brief       Describes a RibbonSingleLineEdit.
+     */
+    struct SingleLineEdit {
+        const char *name;
+        const char *placeholderText = nullptr;
+    };
+
+    /**
+     * @brief       Describes a RibbonSlider.
+     */
+    struct Slider {
+        const char *name;
+        Qt::Orientation orientation = Qt::Horizontal;
+        int minimum = 0;
+        int maximum = 100;
+    };
+
+    /**
+     * @brief       Describes a RibbonToolButton.
+     */
+    struct ToolButton {
+        const char *name;
+        const char *text;
+        const char *icon = nullptr;
+    };
+
+    /**
+     * @brief       Describes a RibbonGroup and the controls it contains.
+     */
+    template <class... Controls>
+    struct Group {
+        static_assert(sizeof...(Controls)>0, "a ribbon group must contain at least one control");
+
+        constexpr Group(const char *name, Controls... controls) :
+                name(name),
+                controls(controls...) {
+
+        }
+
+        static constexpr auto controlCount = sizeof...(Controls);
+
+        const char *name;
+        std::tuple<Controls...> controls;
+    };
+
+    template <class... Controls>
+    Group(const char *, Controls...) -> Group<Controls...>;
+
+    /**
+     * @brief       Describes a tab of the ribbon and the groups on its page.
+     */
+    template <class... Groups>
+    struct Tab {
+        constexpr Tab(const char *title, Groups... groups) :
+                title(title),
+                groups(groups...) {
+
+        }
+
+        static constexpr auto groupCount = sizeof...(Groups);
+        static constexpr auto controlCount = (Groups::controlCount + ... + 0);
+
+        const char *title;
+        std::tuple<Groups...> groups;
+    };
+
+    template <class... Groups>
+    Tab(const char *, Groups...) -> Tab<Groups...>;
+
+    /**
+     * @brief       Describes a ribbon and its tabs.
+     */
+    template <class... Tabs>
+    struct Ribbon {
+        constexpr explicit Ribbon(Tabs... tabs) :
+                tabs(tabs...) {
+
+        }
+
+        static constexpr auto tabCount = sizeof...(Tabs);
+        static constexpr auto groupCount = (Tabs::groupCount + ... + 0);
+        static constexpr auto controlCount = (Tabs::controlCount + ... + 0);
+
+        std::tuple<Tabs...> tabs;
+    };
+
+    template <class... Tabs>
+    Ribbon(Tabs...) -> Ribbon<Tabs...>;
+
+    /**
+     * @brief       Calls the function for each element of a tuple, the calls are unrolled at compile time.
+     *
+     * @param[in]   tuple the tuple.
+     * @param[in]   function the function to call with each element.
+     */
+    template <class Tuple, class Function>
+    inline auto forEach(const Tuple &tuple, Function &&function) -> void {
+        std::apply([&function](const auto &... elements) {
+            (function(elements), ...);
+        }, tuple);
+    }
+
+    inline auto createControl(const Button &descriptor) -> QWidget * {
+        auto button = new Nedrysoft::Ribbon::RibbonButton;
+
+        button->setText(QString::fromUtf8(descriptor.text));
+        button->setIconSize(QSize(descriptor.iconWidth, descriptor.iconHeight));
+
+        if (descriptor.icon) {
+            button->setIcon(QIcon(QString::fromUtf8(descriptor.icon)));
+        }
+
+        return button;
+    }
+
+    inline auto createControl(const CheckBox &descriptor) -> QWidget * {
+        auto checkBox = new Nedrysoft::Ribbon::RibbonCheckBox;
+
+        checkBox->setText(QString::fromUtf8(descriptor.text));
+        checkBox->setChecked(descriptor.checked);
+
+        return checkBox;
+    }
+
+    template <std::size_t ItemCount>
+    inline auto createControl(const ComboBox<ItemCount> &descriptor) -> QWidget * {
+        auto comboBox = new Nedrysoft::Ribbon::RibbonComboBox;
+
+        for (auto item : descriptor.items) {
+            comboBox->addItem(QString::fromUtf8(item));
+        }
+
+        return comboBox;
+    }
+
+    inline auto createControl(const DropButton &descriptor) -> QWidget * {
+        auto dropButton = new Nedrysoft::Ribbon::RibbonDropButton;
+
+        dropButton->setText(QString::fromUtf8(descriptor.text));
+        dropButton->setVertical(descriptor.vertical);
+        dropButton->setIconSize(QSize(descriptor.iconWidth, descriptor.iconHeight));
+
+        if (descriptor.icon) {
+            auto icon = QIcon(QString::fromUtf8(descriptor.icon));
+
+            dropButton->setIcon(icon);
+        }
+
+        return dropButton;
+    }
+
+    inline auto createControl(const LineEdit &descriptor) -> QWidget * {
+        auto lineEdit = new Nedrysoft::Ribbon::RibbonLineEdit;
+
+        if (descriptor.placeholderText) {
+            lineEdit->setPlaceholderText(QString::fromUtf8(descriptor.placeholderText));
+        }
+
+        return lineEdit;
+    }
+
+    inline auto createControl(const PushButton &descriptor) -> QWidget * {
+        auto pushButton = new Nedrysoft::Ribbon::RibbonPushButton;
+
+        pushButton->setText(QString::fromUtf8(descriptor.text));
+        pushButton->setIconSize(QSize(descriptor.iconWidth, descriptor.iconHeight));
+
+        if (descriptor.icon) {
+            auto icon = QIcon(QString::fromUtf8(descriptor.icon));
+
+            pushButton->setIcon(icon);
+        }
+
+        return pushButton;
+    }
+
+    inline auto createControl(const SingleLineEdit &descriptor) -> QWidget * {
+        auto singleLineEdit = new Nedrysoft::Ribbon::RibbonSingleLineEdit;
+
+        if (descriptor.placeholderText) {
+            singleLineEdit->setPlaceholderText(QString::fromUtf8(descriptor.placeholderText));
+        }
+
+        return singleLineEdit;
+    }
+
+    inline auto createControl(const Slider &descriptor) -> QWidget * {
+        auto slider = new Nedrysoft::Ribbon::RibbonSlider;
+
+        slider->setOrientation(descriptor.orientation);
+        slider->setRange(descriptor.minimum, descriptor.maximum);
+
+        return slider;
+    }
+
+    inline auto createControl(const ToolButton &descriptor) -> QWidget * {
+        auto toolButton = new Nedrysoft::Ribbon::RibbonToolButton;
+
+        toolButton->setText(QString::fromUtf8(descriptor.text));
+
+        if (descriptor.icon) {
+            toolButton->setIcon(QIcon(QString::fromUtf8(descriptor.icon)));
+        }
+
+        return toolButton;
+    }
+
+    /**
+     * @brief       Creates the page for a tab.
+     *
+     * @param[in]   tab the tab descriptor.
+     *
+     * @returns     the page widget.
+     */
+    template <class... Groups>
+    inline auto createPage(const Tab<Groups...> &tab) -> QWidget * {
+        auto page = new QWidget;
+        auto pageLayout = new QHBoxLayout(page);
+
+        pageLayout->setContentsMargins(0, 0, 0, 0);
+        pageLayout->setSpacing(0);
+
+        forEach(tab.groups, [pageLayout](const auto &groupDescriptor) {
+            auto group = new Nedrysoft::Ribbon::RibbonGroup;
+            auto groupLayout = new QHBoxLayout(group);
+
+            group->setGroupName(QString::fromUtf8(groupDescriptor.name));
+
+            forEach(groupDescriptor.controls, [groupLayout](const auto &controlDescriptor) {
+                auto control = createControl(controlDescriptor);
+
+                control->setObjectName(QString::fromUtf8(controlDescriptor.name));
+
+                groupLayout->addWidget(control);
+            });
+
+            pageLayout->addWidget(group);
+        });
+
+        pageLayout->addStretch();
+
+        return page;
+    }
+
+    /**
+     * @brief       Adds the tabs of a ribbon descriptor to the ribbon.
+     *
+     * @note        The pages are added with RibbonWidget::addLazyTab, so the controls of a tab are only created
+     *              when the tab is first needed.
+     *
+     * @param[in]   ribbonWidget the ribbon to add the tabs to.
+     * @param[in]   ribbon the ribbon descriptor.
+     */
+    template <class... Tabs>
+    inline auto build(Nedrysoft::Ribbon::RibbonWidget *ribbonWidget, const Ribbon<Tabs...> &ribbon) -> void {
+        forEach(ribbon.tabs, [ribbonWidget](const auto &tab) {
+            ribbonWidget->addLazyTab(QString::fromUtf8(tab.title), [tab]() -> QWidget * {
+                return createPage(tab);
+            });
+        });
+    }
+}}}
+
+#endif // NEDRYSOFT_RIBBONDESCRIPTOR_H
@@ -23,11 +23,15 @@
 
 #include "RibbonDropButton.h"
 
+#include "RibbonIconTinter.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
 #include "RibbonWidget.h"
 
 #include <QApplication>
-#include <QHBoxLayout>
-#include <QVBoxLayout>
+#include <QEvent>
 
 constexpr auto ThemeStylesheet = R"(
     QPushButton {
@@ -50,11 +54,10 @@ Nedrysoft::Ribbon::RibbonDropButton::RibbonDropButton(QWidget *parent) :
         QWidget(parent),
         m_iconSize(QSize(RibbonDropButtonDefaultIconWidth,RibbonDropButtonDefaultIconHeight)),
         m_vertical(true),
-        m_layout(nullptr),
         m_action(nullptr) {
 
-    m_mainButton = new QPushButton;
-    m_dropButton = new QPushButton;
+    m_mainButton = new QPushButton(this);
+    m_dropButton = new QPushButton(this);
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
@@ -73,11 +76,9 @@ Nedrysoft::Ribbon::RibbonDropButton::RibbonDropButton(QWidget *parent) :
 
     connect(m_mainButton, &QPushButton::clicked, [=] (bool checked) {
         if (m_action) {
-            auto dropButtonEvent = new Nedrysoft::Ribbon::DropButtonClickedEvent(this, false);
+            auto dropButtonEvent = Nedrysoft::Ribbon::DropButtonClickedEvent(this, false);
 
-            m_action->triggerEvent(dropButtonEvent);
-
-            delete dropButtonEvent;
+            m_action->triggerEvent(&dropButtonEvent);
         }
 
         Q_EMIT clicked(false);
@@ -85,11 +86,9 @@ Nedrysoft::Ribbon::RibbonDropButton::RibbonDropButton(QWidget *parent) :
 
     connect(m_dropButton, &QPushButton::clicked, [=] (bool checked) {
         if (m_action) {
-            auto dropButtonEvent = new Nedrysoft::Ribbon::DropButtonClickedEvent(this, true);
-
-            m_action->triggerEvent(dropButtonEvent);
+            auto dropButtonEvent = Nedrysoft::Ribbon::DropButtonClickedEvent(this, true);
 
-            delete dropButtonEvent;
+            m_action->triggerEvent(&dropButtonEvent);
         }
 
         Q_EMIT clicked(true);
@@ -97,7 +96,9 @@ Nedrysoft::Ribbon::RibbonDropButton::RibbonDropButton(QWidget *parent) :
 
     updateSizes();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheets(isDarkMode);
     });
 
@@ -114,10 +115,6 @@ Nedrysoft::Ribbon::RibbonDropButton::~RibbonDropButton() {
     if (m_dropButton) {
         delete m_dropButton;
     }
-
-    if (m_layout) {
-        delete m_layout;
-    }
 }
 
 QIcon Nedrysoft::Ribbon::RibbonDropButton::icon() {
@@ -142,73 +139,115 @@ void Nedrysoft::Ribbon::RibbonDropButton::setIconSize(QSize iconSize)
 void Nedrysoft::Ribbon::RibbonDropButton::updateSizes() {
     m_mainButton->setMinimumSize(m_iconSize);
     m_mainButton->setIconSize(m_iconSize);
+
+    updateGeometry();
+    updateLayout();
 }
 
 void Nedrysoft::Ribbon::RibbonDropButton::updateStyleSheets(bool isDarkMode) {
-    QString styleSheet(ThemeStylesheet);
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
 
-    if (isDarkMode) {
-        styleSheet.replace("[normal-background-colour]", "#434343");
-    } else {
-        styleSheet.replace("[normal-background-colour]", "#ffffff");
-    }
+    auto iconTinter = RibbonIconTinter::getInstance();
+    auto glyphColor = GlyphColor[isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light];
 
-    if (isDarkMode) {
-        styleSheet.replace("[hover-colour]", "#4C4C4C");
-    } else {
-        styleSheet.replace("[hover-colour]", "#DDDDDD");
-    }
+    QIcon arrowIcon;
 
-    if (isDarkMode) {
-        styleSheet.replace("[pressed-colour]", "#292929");
-    } else {
-        styleSheet.replace("[pressed-colour]", "#808080");
-    }
+    arrowIcon.addPixmap(iconTinter->pixmap("arrow-drop", glyphColor, 1));
+    arrowIcon.addPixmap(iconTinter->pixmap("arrow-drop", glyphColor, 2));
 
-    this->setStyleSheet(styleSheet);
+    m_dropButton->setIcon(arrowIcon);
 
-    if (isDarkMode) {
-        m_dropButton->setIcon(QIcon(":/Nedrysoft/Ribbon/icons/arrow-drop-dark@2x.png"));
-    } else {
-        m_dropButton->setIcon(QIcon(":/Nedrysoft/Ribbon/icons/arrow-drop-light@2x.png"));
+    if (RibbonStyle::isActive()) {
+        m_mainButton->update();
+        m_dropButton->update();
+
+        return;
     }
+
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
+
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        if (isDarkMode) {
+            styleSheet.replace("[normal-background-colour]", "#434343");
+        } else {
+            styleSheet.replace("[normal-background-colour]", "#ffffff");
+        }
+
+        if (isDarkMode) {
+            styleSheet.replace("[hover-colour]", "#4C4C4C");
+        } else {
+            styleSheet.replace("[hover-colour]", "#DDDDDD");
+        }
+
+        if (isDarkMode) {
+            styleSheet.replace("[pressed-colour]", "#292929");
+        } else {
+            styleSheet.replace("[pressed-colour]", "#808080");
+        }
+
+        return styleSheet;
+    });
+
+    this->setStyleSheet(styleSheet);
 }
 
 auto Nedrysoft::Ribbon::RibbonDropButton::updateLayout() -> void {
-    QBoxLayout *layout;
-    QSpacerItem *spacerItem=nullptr;
+    NEDRYSOFT_RIBBON_MEASURE(Layout);
 
-    if (m_vertical) {
-        layout = new QVBoxLayout;
-        spacerItem = new QSpacerItem(0,0, QSizePolicy::Minimum, QSizePolicy::MinimumExpanding);
+    // the two buttons are positioned directly, matching the box layouts that were previously used, so changing
+    // orientation or size does not allocate.
 
-        m_dropButton->setMinimumHeight(RibbonDropButtonDefaultVerticalHeight);
-        m_dropButton->setMaximumHeight(RibbonDropButtonDefaultVerticalHeight);
+    if (m_vertical) {
+        auto dropHeight = RibbonDropButtonDefaultVerticalHeight;
+        auto mainHeight = qBound(0, m_mainButton->sizeHint().height(), height()-dropHeight);
 
+        m_mainButton->setGeometry(0, 0, width(), mainHeight);
+        m_dropButton->setGeometry(0, mainHeight, width(), dropHeight);
     } else {
-        layout = new QHBoxLayout;
+        auto dropHeight = RibbonDropButtonDefaultHorizontalHeight;
+        auto dropWidth = qMin(m_dropButton->sizeHint().width(), width());
 
-        m_dropButton->setMinimumHeight(RibbonDropButtonDefaultHorizontalHeight);
-        m_dropButton->setMaximumHeight(RibbonDropButtonDefaultHorizontalHeight);
+        m_mainButton->setGeometry(0, 0, width()-dropWidth, height());
+        m_dropButton->setGeometry(width()-dropWidth, (height()-dropHeight)/2, dropWidth, dropHeight);
     }
+}
 
-    layout->addWidget(m_mainButton);
-    layout->addWidget(m_dropButton);
+auto Nedrysoft::Ribbon::RibbonDropButton::sizeHint() const -> QSize {
+    auto mainSize = m_mainButton->sizeHint().expandedTo(m_mainButton->minimumSize());
+    auto dropSize = m_dropButton->sizeHint();
 
-    if (spacerItem) {
-        layout->addSpacerItem(spacerItem);
+    if (m_vertical) {
+        return QSize(qMax(mainSize.width(), dropSize.width()), mainSize.height()+RibbonDropButtonDefaultVerticalHeight);
     }
 
-    layout->setContentsMargins(0,0,0,0);
-    layout->setSpacing(0);
+    return QSize(mainSize.width()+dropSize.width(), qMax(mainSize.height(), RibbonDropButtonDefaultHorizontalHeight));
+}
+
+auto Nedrysoft::Ribbon::RibbonDropButton::minimumSizeHint() const -> QSize {
+    return sizeHint();
+}
+
+auto Nedrysoft::Ribbon::RibbonDropButton::event(QEvent *event) -> bool {
+    if (event->type()==QEvent::LayoutRequest) {
+        // a child button has changed its size hint.
 
-    if (m_layout) {
-        delete m_layout;
+        updateGeometry();
+        updateLayout();
     }
 
-    m_layout = layout;
+    return QWidget::event(event);
+}
 
-    setLayout(m_layout);
+auto Nedrysoft::Ribbon::RibbonDropButton::resizeEvent(QResizeEvent *event) -> void {
+    QWidget::resizeEvent(event);
+
+    updateLayout();
 }
 
 auto Nedrysoft::Ribbon::RibbonDropButton::vertical() -> bool {
@@ -216,8 +255,18 @@ auto Nedrysoft::Ribbon::RibbonDropButton::vertical() -> bool {
 }
 
 auto Nedrysoft::Ribbon::RibbonDropButton::setVertical(const bool vertical) -> void {
+    if (vertical==m_vertical) {
+        return;
+    }
+
     m_vertical = vertical;
 
+    auto dropHeight = m_vertical ? RibbonDropButtonDefaultVerticalHeight : RibbonDropButtonDefaultHorizontalHeight;
+
+    m_dropButton->setMinimumHeight(dropHeight);
+    m_dropButton->setMaximumHeight(dropHeight);
+
+    updateGeometry();
     updateLayout();
 }
 
@@ -237,8 +286,19 @@ auto Nedrysoft::Ribbon::RibbonDropButton::setText(const QString &text) -> void {
     }
 
     m_mainButton->setText(padding+m_text);
+
+    updateGeometry();
+    updateLayout();
 }
 
 auto Nedrysoft::Ribbon::RibbonDropButton::setAction(Nedrysoft::Ribbon::RibbonAction *action) -> void {
+    if (m_action) {
+        m_action->removeWidget(this);
+    }
+
     m_action = action;
+
+    if (m_action) {
+        m_action->addWidget(this);
+    }
 }
\ No newline at end of file
@@ -27,8 +27,8 @@
 #include "RibbonAction.h"
 #include "RibbonSpec.h"
 
+#include <QPointer>
 #include <QPushButton>
-#include <QBoxLayout>
 #include <QWidget>
 #include <ThemeSupport>
 
@@ -140,6 +140,37 @@ namespace Nedrysoft { namespace Ribbon {
              */
             void setAction(Nedrysoft::Ribbon::RibbonAction *action);
 
+            /**
+             * @brief       Reimplements: QWidget::sizeHint().
+             *
+             * @returns     the preferred size of the drop button.
+             */
+            auto sizeHint() const -> QSize override;
+
+            /**
+             * @brief       Reimplements: QWidget::minimumSizeHint().
+             *
+             * @returns     the minimum size of the drop button.
+             */
+            auto minimumSizeHint() const -> QSize override;
+
+        protected:
+            /**
+             * @brief       Reimplements: QWidget::event(QEvent *event).
+             *
+             * @param[in]   event the event information.
+             *
+             * @returns     true if the event was handled; otherwise false.
+             */
+            auto event(QEvent *event) -> bool override;
+
+            /**
+             * @brief       Reimplements: QWidget::resizeEvent(QResizeEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto resizeEvent(QResizeEvent *event) -> void override;
+
         private:
             /**
              * @brief       Updates the child widgets when the size of the icon is changed.
@@ -154,7 +185,7 @@ namespace Nedrysoft { namespace Ribbon {
             auto updateStyleSheets(bool isDarkMode) -> void;
 
             /**
-             * @brief       Updates the widgets layout when the vertical property has been changed.
+             * @brief       Positions the main and drop-down buttons for the current size and orientation.
              */
             auto updateLayout() -> void;
 
@@ -176,13 +207,12 @@ namespace Nedrysoft { namespace Ribbon {
         private:
             //! @cond
 
-            QBoxLayout *m_layout;
             QPushButton *m_mainButton;
             QPushButton *m_dropButton;
             QSize m_iconSize;
             bool m_vertical;
             QString m_text;
-            RibbonAction *m_action;
+            QPointer<RibbonAction> m_action;
 
             //! @endcond
     };
@@ -25,9 +25,21 @@
 
 #include <QFontDatabase>
 
+constexpr auto FontNotLoaded = -2;
+
+static auto fontFamily(int fontId) -> QString {
+    auto families = QFontDatabase::applicationFontFamilies(fontId);
+
+    if (families.count()) {
+        return families.at(0);
+    }
+
+    return QString();
+}
+
 Nedrysoft::Ribbon::RibbonFontManager::RibbonFontManager() :
-        m_regularFontId(QFontDatabase::addApplicationFont(":/Nedrysoft/Ribbon/OpenSans/OpenSans-Regular.ttf")),
-        m_boldFontId(QFontDatabase::addApplicationFont(":/Nedrysoft/Ribbon/OpenSans/OpenSans-Bold.ttf")) {
+        m_regularFontId(FontNotLoaded),
+        m_boldFontId(FontNotLoaded) {
 
 }
 
@@ -38,21 +50,68 @@ auto Nedrysoft::Ribbon::RibbonFontManager::getInstance() ->Nedrysoft::Ribbon::Ri
 }
 
 auto Nedrysoft::Ribbon::RibbonFontManager::normalFont() -> QString const {
-    auto families = QFontDatabase::applicationFontFamilies(m_regularFontId);
+    return family(Nedrysoft::Ribbon::FontRole::Normal);
+}
 
-    if (families.count()) {
-        return families.at(0);
+auto Nedrysoft::Ribbon::RibbonFontManager::boldFont() -> QString const {
+    return family(Nedrysoft::Ribbon::FontRole::Bold);
+}
+
+auto Nedrysoft::Ribbon::RibbonFontManager::font(Nedrysoft::Ribbon::FontRole role, int pointSize) -> QFont {
+    auto key = qMakePair(static_cast<int>(role), pointSize);
+
+    auto iterator = m_fonts.constFind(key);
+
+    if (iterator!=m_fonts.constEnd()) {
+        return iterator.value();
     }
 
-    return QString();
+    QFont font;
+
+    if (role==Nedrysoft::Ribbon::FontRole::Bold) {
+        font = QFont(family(role), pointSize, QFont::Bold);
+    } else {
+        font = QFont(family(role), pointSize);
+    }
+
+    m_fonts.insert(key, font);
+
+    return font;
 }
 
-auto Nedrysoft::Ribbon::RibbonFontManager::boldFont() -> QString const {
-    auto families = QFontDatabase::applicationFontFamilies(m_boldFontId);
+auto Nedrysoft::Ribbon::RibbonFontManager::fontMetrics(
+        Nedrysoft::Ribbon::FontRole role,
+        int pointSize) -> QFontMetrics {
 
-    if (families.count()) {
-        return families.at(0);
+    auto key = qMakePair(static_cast<int>(role), pointSize);
+
+    auto iterator = m_fontMetrics.constFind(key);
+
+    if (iterator!=m_fontMetrics.constEnd()) {
+        return iterator.value();
     }
 
-    return QString();
+    auto fontMetrics = QFontMetrics(font(role, pointSize));
+
+    m_fontMetrics.insert(key, fontMetrics);
+
+    return fontMetrics;
+}
+
+auto Nedrysoft::Ribbon::RibbonFontManager::family(Nedrysoft::Ribbon::FontRole role) -> QString {
+    if (role==Nedrysoft::Ribbon::FontRole::Bold) {
+        if (m_boldFontId==FontNotLoaded) {
+            m_boldFontId = QFontDatabase::addApplicationFont(":/Nedrysoft/Ribbon/OpenSans/OpenSans-Bold.ttf");
+            m_boldFamily = fontFamily(m_boldFontId);
+        }
+
+        return m_boldFamily;
+    }
+
+    if (m_regularFontId==FontNotLoaded) {
+        m_regularFontId = QFontDatabase::addApplicationFont(":/Nedrysoft/Ribbon/OpenSans/OpenSans-Regular.ttf");
+        m_normalFamily = fontFamily(m_regularFontId);
+    }
+
+    return m_normalFamily;
 }
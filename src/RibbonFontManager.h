@@ -26,15 +26,27 @@
 
 #include "RibbonSpec.h"
 
+#include <QFont>
+#include <QFontMetrics>
+#include <QHash>
+#include <QPair>
 #include <QString>
 
 namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The roles of the fonts used by the ribbon.
+     */
+    enum class FontRole {
+        Normal = 0,                                                             /**< The regular font. */
+        Bold = 1                                                                /**< The bold font. */
+    };
+
     /**
      * @brief           The RibbonFont manager provides access to the system UI font.
      *
-     * @details         Singleton responsible for loading and returning the fonts used
-     *                  by the ribbon control.  This class is a singleton and therefore cannot be instantiated directly
-     *                  the instance can be obtained using the getInstance() method.
+     * @details         Singleton responsible for loading and returning the fonts used by the ribbon control, each
+     *                  font face is loaded on first use.  This class is a singleton and therefore cannot be
+     *                  instantiated directly, the instance can be obtained using the getInstance() method.
      */
     class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonFontManager {
         private:
@@ -78,11 +90,49 @@ namespace Nedrysoft { namespace Ribbon {
              */
             auto boldFont() -> QString const;
 
+            /**
+             * @brief       Returns the font for the given role and size.
+             *
+             * @note        The fonts are built once and then shared by all callers.
+             *
+             * @param[in]   role the role of the font.
+             * @param[in]   pointSize the point size of the font.
+             *
+             * @returns     the font.
+             */
+            auto font(Nedrysoft::Ribbon::FontRole role, int pointSize) -> QFont;
+
+            /**
+             * @brief       Returns the font metrics of the font for the given role and size.
+             *
+             * @param[in]   role the role of the font.
+             * @param[in]   pointSize the point size of the font.
+             *
+             * @returns     the font metrics.
+             */
+            auto fontMetrics(Nedrysoft::Ribbon::FontRole role, int pointSize) -> QFontMetrics;
+
+        private:
+            /**
+             * @brief       Returns the family name of the font for the given role.
+             *
+             * @note        The font face is loaded from the resources the first time it is requested.
+             *
+             * @param[in]   role the role of the font.
+             *
+             * @returns     the font family name; otherwise an empty string if the face could not be loaded.
+             */
+            auto family(Nedrysoft::Ribbon::FontRole role) -> QString;
+
         private:
             //! @cond
 
             int m_regularFontId;
             int m_boldFontId;
+            QString m_normalFamily;
+            QString m_boldFamily;
+            QHash<QPair<int, int>, QFont> m_fonts;
+            QHash<QPair<int, int>, QFontMetrics> m_fontMetrics;
 
             //! @endcond
     };
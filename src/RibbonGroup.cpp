@@ -24,6 +24,8 @@
 #include "RibbonGroup.h"
 
 #include "RibbonFontManager.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
 #include "RibbonWidget.h"
 
 #include <QApplication>
@@ -40,16 +42,17 @@ constexpr auto TitleAdjustment = 0;
 
 Nedrysoft::Ribbon::RibbonGroup::RibbonGroup(QWidget *parent) :
         QWidget(parent),
-        m_fontMetrics(QFont()) {
+        m_font(RibbonFontManager::getInstance()->font(FontRole::Normal, RibbonGroupDefaultFontSize)),
+        m_fontMetrics(RibbonFontManager::getInstance()->fontMetrics(FontRole::Normal, RibbonGroupDefaultFontSize)),
+        m_captionTheme(Nedrysoft::Ribbon::Light) {
 
-    auto fontManager = RibbonFontManager::getInstance();
+    // set the group font, this then propagates down to all children of the group.
 
-    m_font = QFont(fontManager->normalFont(), RibbonGroupDefaultFontSize);
-    m_fontMetrics = QFontMetrics(m_font);
-
-    // set the stylesheet font, this then propagates down to all children of the group.
-
-    this->setStyleSheet(QString("font: %1pt \"%2\"").arg(m_font.pointSize()).arg(m_font.family()));
+    if (RibbonStyle::isActive()) {
+        setFont(m_font);
+    } else {
+        this->setStyleSheet(QString("font: %1pt \"%2\"").arg(m_font.pointSize()).arg(m_font.family()));
+    }
 
     setGroupName(QString("Group"));
 #if (QT_VERSION_MAJOR<6)
@@ -80,8 +83,9 @@ auto Nedrysoft::Ribbon::RibbonGroup::event(QEvent *event) -> bool {
 }
 
 auto Nedrysoft::Ribbon::RibbonGroup::paintEvent(QPaintEvent *event) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(Paint);
+
     QPainter painter(this);
-    auto widgetRect = rect();
     auto currentTheme = Nedrysoft::Ribbon::Light;
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
@@ -90,32 +94,67 @@ auto Nedrysoft::Ribbon::RibbonGroup::paintEvent(QPaintEvent *event) -> void {
         currentTheme = Nedrysoft::Ribbon::Dark;
     }
 
-    widgetRect.setTop(widgetRect.bottom()-m_textRect.height());
+    // repaints triggered by child controls only redraw the caption if their dirty region overlaps it.
 
-    painter.save();
+    auto captionRect = this->captionRect();
 
-    painter.setFont(m_font);
+    if (event->region().intersects(captionRect)) {
+        painter.drawPixmap(captionRect.topLeft(), captionPixmap(currentTheme));
+    }
+
+    auto startPoint = QPoint(rect().right()-1, rect().top()+Ribbon::GroupDividerMargin);
+    auto endPoint = QPoint(rect().right()-1, rect().bottom()-Ribbon::GroupDividerMargin);
+
+    if (event->rect().right()>=startPoint.x()) {
+        painter.setPen(Ribbon::GroupDividerColor[currentTheme]);
+
+        painter.drawLine(startPoint, endPoint);
+    }
 
-    painter.setPen(Ribbon::TextColor[currentTheme]);
+    QWidget::paintEvent(event);
+}
 
+auto Nedrysoft::Ribbon::RibbonGroup::captionRect() -> QRect {
     auto textRect = contentsRect();
 
     textRect.setBottom(rect().bottom());
+    textRect.adjust(0, 0, 0, TitleAdjustment);
+    textRect.setTop(textRect.bottom()-m_fontMetrics.height()+1);
 
-    painter.drawText(textRect.adjusted(0, 0, 0, TitleAdjustment), m_groupName, Qt::AlignBottom | Qt::AlignHCenter);
+    return textRect;
+}
 
-    painter.setClipRect(event->rect());
+auto Nedrysoft::Ribbon::RibbonGroup::captionPixmap(Nedrysoft::Ribbon::ThemeMode theme) -> QPixmap {
+    auto captionSize = captionRect().size();
+    auto pixelRatio = devicePixelRatioF();
 
-    painter.setPen(Ribbon::GroupDividerColor[currentTheme]);
+    if ((m_captionTheme==theme) &&
+        (m_captionPixmap.size()==(captionSize*pixelRatio)) &&
+        (qFuzzyCompare(m_captionPixmap.devicePixelRatioF(), pixelRatio)) &&
+        (!m_captionPixmap.isNull())) {
 
-    auto startPoint = QPoint(rect().right()-1, rect().top()+Ribbon::GroupDividerMargin);
-    auto endPoint = QPoint(rect().right()-1, rect().bottom()-Ribbon::GroupDividerMargin);
+        return m_captionPixmap;
+    }
 
-    painter.drawLine(startPoint, endPoint);
+    m_captionPixmap = QPixmap(captionSize*pixelRatio);
 
-    painter.restore();
+    m_captionPixmap.setDevicePixelRatio(pixelRatio);
+    m_captionPixmap.fill(Qt::transparent);
 
-    QWidget::paintEvent(event);
+    m_captionTheme = theme;
+
+    if (m_captionPixmap.isNull()) {
+        return m_captionPixmap;
+    }
+
+    QPainter painter(&m_captionPixmap);
+
+    painter.setFont(m_font);
+    painter.setPen(Ribbon::TextColor[theme]);
+
+    painter.drawText(QRect(QPoint(0, 0), captionSize), m_groupName, Qt::AlignBottom | Qt::AlignHCenter);
+
+    return m_captionPixmap;
 }
 
 auto Nedrysoft::Ribbon::RibbonGroup::groupName() -> QString const {
@@ -128,9 +167,21 @@ auto Nedrysoft::Ribbon::RibbonGroup::setGroupName(const QString &groupName) -> v
     updateMargins();
 }
 
+auto Nedrysoft::Ribbon::RibbonGroup::collapsedIcon() const -> QIcon {
+    return m_collapsedIcon;
+}
+
+auto Nedrysoft::Ribbon::RibbonGroup::setCollapsedIcon(const QIcon &icon) -> void {
+    m_collapsedIcon = icon;
+}
+
 auto Nedrysoft::Ribbon::RibbonGroup::updateMargins() -> void {
+    NEDRYSOFT_RIBBON_MEASURE(Layout);
+
     m_textRect = m_fontMetrics.boundingRect(m_groupName);
 
+    m_captionPixmap = QPixmap();
+
     setMinimumWidth(m_textRect.width()+(RibbonGroupHorizontalMargins*2));
 
     setContentsMargins(RibbonGroupHorizontalMargins, 0, RibbonGroupHorizontalMargins, m_textRect.height());
@@ -27,9 +27,12 @@
 #include <QtGlobal>
 
 #include "RibbonSpec.h"
+#include "RibbonWidget.h"
 
 #include <QFontMetrics>
+#include <QIcon>
 #include <QMap>
+#include <QPixmap>
 #include <QWidget>
 
 namespace Nedrysoft { namespace Ribbon {
@@ -55,6 +58,7 @@ namespace Nedrysoft { namespace Ribbon {
             //! @cond
 
             Q_PROPERTY(QString groupName READ groupName WRITE setGroupName)
+            Q_PROPERTY(QIcon collapsedIcon READ collapsedIcon WRITE setCollapsedIcon)
 
             //! @endcond
 
@@ -78,6 +82,23 @@ namespace Nedrysoft { namespace Ribbon {
              */
             auto setGroupName(const QString &name) -> void;
 
+            /**
+             * @brief       Returns the icon shown when the group is collapsed by adaptive reduction.
+             *
+             * @returns     the icon.
+             */
+            auto collapsedIcon() const -> QIcon;
+
+            /**
+             * @brief       Sets the icon shown when the group is collapsed by adaptive reduction.
+             *
+             * @note        The collapsed button shows the group name below the icon, or only the name if the icon
+             *              is null.
+             *
+             * @param[in]   icon the icon.
+             */
+            auto setCollapsedIcon(const QIcon &icon) -> void;
+
             /**
              * @brief       Updates the margins to account for the group border.
              */
@@ -100,13 +121,35 @@ namespace Nedrysoft { namespace Ribbon {
              */
             auto event(QEvent *event) -> bool override;
 
+        private:
+            /**
+             * @brief       Returns the rectangle that the group caption is drawn in.
+             *
+             * @returns     the caption rectangle in widget coordinates.
+             */
+            auto captionRect() -> QRect;
+
+            /**
+             * @brief       Returns the pre-rendered group caption.
+             *
+             * @note        The pixmap is only re-rendered when the name, theme, size or device pixel ratio changes.
+             *
+             * @param[in]   theme the current theme.
+             *
+             * @returns     the caption pixmap.
+             */
+            auto captionPixmap(Nedrysoft::Ribbon::ThemeMode theme) -> QPixmap;
+
         private:
             //! @cond
 
             QString m_groupName;
+            QIcon m_collapsedIcon;
             QFont m_font;
             QFontMetrics m_fontMetrics;
             QRect m_textRect;
+            QPixmap m_captionPixmap;
+            Nedrysoft::Ribbon::ThemeMode m_captionTheme;
 
             //! @endcond
     };
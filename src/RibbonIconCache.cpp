@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonIconCache.h"
+
+#include <QImage>
+
+Nedrysoft::Ribbon::RibbonIconCache::RibbonIconCache() :
+        m_memoryUsage(0),
+        m_hits(0),
+        m_misses(0) {
+
+}
+
+auto Nedrysoft::Ribbon::RibbonIconCache::getInstance() -> Nedrysoft::Ribbon::RibbonIconCache * {
+    static RibbonIconCache instance;
+
+    return &instance;
+}
+
+auto Nedrysoft::Ribbon::RibbonIconCache::pixmap(
+        const QString &resource,
+        Nedrysoft::Ribbon::ThemeMode theme,
+        const QSize &size,
+        qreal devicePixelRatio) -> QPixmap {
+
+    auto key = QString("%1:%2:%3x%4:%5")
+            .arg(resource)
+            .arg(static_cast<int>(theme))
+            .arg(size.width())
+            .arg(size.height())
+            .arg(devicePixelRatio);
+
+    auto iterator = m_pixmaps.constFind(key);
+
+    if (iterator!=m_pixmaps.constEnd()) {
+        m_hits++;
+
+        return iterator.value();
+    }
+
+    m_misses++;
+
+    auto resourceName = QString(resource).replace("[theme]", (theme==Nedrysoft::Ribbon::Dark) ? "dark" : "light");
+
+    if (devicePixelRatio>1) {
+        auto extension = resourceName.lastIndexOf('.');
+
+        if (extension>=0) {
+            resourceName.insert(extension, "@2x");
+        }
+    }
+
+    auto image = QImage(resourceName);
+
+    // scale the image once to the number of device pixels it covers, rather than on every draw.
+
+    if ((!image.isNull()) && (size.isValid())) {
+        auto deviceSize = size*devicePixelRatio;
+
+        if (image.size()!=deviceSize) {
+            image = image.scaled(deviceSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        }
+    }
+
+    auto pixmap = QPixmap::fromImage(image);
+
+    if (size.isValid()) {
+        pixmap.setDevicePixelRatio(devicePixelRatio);
+    } else {
+        pixmap.setDevicePixelRatio((devicePixelRatio>1) ? 2 : 1);
+    }
+
+    m_memoryUsage += static_cast<qint64>(pixmap.width())*pixmap.height()*pixmap.depth()/8;
+
+    m_pixmaps.insert(key, pixmap);
+
+    return pixmap;
+}
+
+auto Nedrysoft::Ribbon::RibbonIconCache::clear() -> void {
+    m_pixmaps.clear();
+
+    m_memoryUsage = 0;
+}
+
+auto Nedrysoft::Ribbon::RibbonIconCache::hits() const -> quint64 {
+    return m_hits;
+}
+
+auto Nedrysoft::Ribbon::RibbonIconCache::misses() const -> quint64 {
+    return m_misses;
+}
+
+auto Nedrysoft::Ribbon::RibbonIconCache::hitRate() const -> double {
+    auto requests = m_hits+m_misses;
+
+    if (!requests) {
+        return 0;
+    }
+
+    return static_cast<double>(m_hits)/static_cast<double>(requests);
+}
+
+auto Nedrysoft::Ribbon::RibbonIconCache::memoryUsage() const -> qint64 {
+    return m_memoryUsage;
+}
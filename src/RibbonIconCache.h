@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONICONCACHE_H
+#define NEDRYSOFT_RIBBONICONCACHE_H
+
+#include "RibbonSpec.h"
+#include "RibbonWidget.h"
+
+#include <QHash>
+#include <QPixmap>
+#include <QSize>
+#include <QString>
+
+namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The RibbonIconCache provides a process wide store of decoded ribbon images.
+     *
+     * @details     Images are decoded and scaled once for each resource, theme, size and device pixel ratio, the
+     *              resulting (implicitly shared) QPixmap is then handed out to every control that draws the image.
+     *              This class is a singleton and therefore cannot be instantiated directly, the instance can be
+     *              obtained using the getInstance() method.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonIconCache {
+        private:
+            /**
+             * @brief       Constructs a new RibbonIconCache.
+             *
+             * @note        Cannot be directly instantiated, this is a singleton class and the instance can be
+             *              accessed through the getInstance() method.
+             */
+            explicit RibbonIconCache();
+
+            /**
+             * @brief       Delete the copy constructor.
+             */
+            RibbonIconCache(const RibbonIconCache&) = delete;
+
+            /**
+             * @brief       Delete the assignment operator.
+             */
+            RibbonIconCache& operator=(const RibbonIconCache&) = delete;
+
+        public:
+            /**
+             * @brief       Returns the singleton instance of the RibbonIconCache class.
+             *
+             * @returns     the instance of the class.
+             */
+            static auto getInstance() -> Nedrysoft::Ribbon::RibbonIconCache *;
+
+            /**
+             * @brief       Returns the image for the given resource, theme, size and device pixel ratio.
+             *
+             * @note        The [theme] placeholder in the resource name is replaced with "light" or "dark", and the
+             *              2x variant of the resource is loaded if the device pixel ratio is greater than 1.
+             *
+             * @param[in]   resource the resource name, i.e ":/Nedrysoft/Ribbon/icons/checked-[theme].png".
+             * @param[in]   theme the theme of the image.
+             * @param[in]   size the size the image is drawn at; or an invalid size to use the size of the image.
+             * @param[in]   devicePixelRatio the device pixel ratio that the image will be drawn at.
+             *
+             * @returns     the image.
+             */
+            auto pixmap(
+                    const QString &resource,
+                    Nedrysoft::Ribbon::ThemeMode theme,
+                    const QSize &size,
+                    qreal devicePixelRatio) -> QPixmap;
+
+            /**
+             * @brief       Removes all images from the cache.
+             *
+             * @note        The hit and miss counters are not reset.
+             */
+            auto clear() -> void;
+
+            /**
+             * @brief       Returns the number of requests that were satisfied from the cache.
+             *
+             * @returns     the number of cache hits.
+             */
+            auto hits() const -> quint64;
+
+            /**
+             * @brief       Returns the number of requests that required the image to be decoded.
+             *
+             * @returns     the number of cache misses.
+             */
+            auto misses() const -> quint64;
+
+            /**
+             * @brief       Returns the proportion of requests that were satisfied from the cache.
+             *
+             * @returns     the hit rate between 0 and 1.
+             */
+            auto hitRate() const -> double;
+
+            /**
+             * @brief       Returns the memory used by the images held in the cache.
+             *
+             * @returns     the size in bytes.
+             */
+            auto memoryUsage() const -> qint64;
+
+        private:
+            //! @cond
+
+            QHash<QString, QPixmap> m_pixmaps;
+            qint64 m_memoryUsage;
+            quint64 m_hits;
+            quint64 m_misses;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONICONCACHE_H
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonIconTinter.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP>=2))
+#define NEDRYSOFT_RIBBON_TINT_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define NEDRYSOFT_RIBBON_TINT_NEON
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief       Scales a premultiplied colour by the given alpha, this is the reference for the vector kernels.
+ *
+ * @param[in]   pixels the pixels to recolour.
+ * @param[in]   count the number of pixels.
+ * @param[in]   color the premultiplied colour.
+ */
+static auto tintScalar(quint32 *pixels, int count, QRgb color) -> void {
+    for (int index = 0; index<count; index++) {
+        auto alpha = pixels[index] >> 24;
+        quint32 result = 0;
+
+        for (auto shift = 0; shift<32; shift += 8) {
+            auto value = ((color >> shift) & 0xff)*alpha+128;
+
+            result |= ((value+(value >> 8)) >> 8) << shift;
+        }
+
+        pixels[index] = result;
+    }
+}
+
+#if defined(NEDRYSOFT_RIBBON_TINT_SSE2)
+
+static auto tintVector(quint32 *pixels, int count, QRgb color) -> int {
+    auto zero = _mm_setzero_si128();
+    auto rounding = _mm_set1_epi16(128);
+    auto colorVector = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)), zero);
+    int index = 0;
+
+    for (; index+4<=count; index += 4) {
+        auto source = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels+index));
+
+        // replicate the alpha of each pixel into all four of its channels.
+
+        auto alpha = _mm_srli_epi32(source, 24);
+
+        alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+        alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+
+        auto low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(alpha, zero), colorVector), rounding);
+        auto high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(alpha, zero), colorVector), rounding);
+
+        low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+        high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels+index), _mm_packus_epi16(low, high));
+    }
+
+    return index;
+}
+
+#elif defined(NEDRYSOFT_RIBBON_TINT_NEON)
+
+static auto tintVector(quint32 *pixels, int count, QRgb color) -> int {
+    auto blue = vdup_n_u8(static_cast<uint8_t>(color));
+    auto green = vdup_n_u8(static_cast<uint8_t>(color >> 8));
+    auto red = vdup_n_u8(static_cast<uint8_t>(color >> 16));
+    auto alpha = vdup_n_u8(static_cast<uint8_t>(color >> 24));
+    int index = 0;
+
+    for (; index+8<=count; index += 8) {
+        auto bytes = reinterpret_cast<uint8_t *>(pixels+index);
+        auto source = vld4_u8(bytes);
+        auto mask = source.val[3];
+
+        uint8x8x4_t result;
+
+        // multiply and divide by 255 with rounding, matching the scalar implementation.
+
+        auto blueProduct = vmull_u8(blue, mask);
+        auto greenProduct = vmull_u8(green, mask);
+        auto redProduct = vmull_u8(red, mask);
+        auto alphaProduct = vmull_u8(alpha, mask);
+
+        result.val[0] = vrshrn_n_u16(vrsraq_n_u16(blueProduct, blueProduct, 8), 8);
+        result.val[1] = vrshrn_n_u16(vrsraq_n_u16(greenProduct, greenProduct, 8), 8);
+        result.val[2] = vrshrn_n_u16(vrsraq_n_u16(redProduct, redProduct, 8), 8);
+        result.val[3] = vrshrn_n_u16(vrsraq_n_u16(alphaProduct, alphaProduct, 8), 8);
+
+        vst4_u8(bytes, result);
+    }
+
+    return index;
+}
+
+#else
+
+static auto tintVector(quint32 *pixels, int count, QRgb color) -> int {
+    Q_UNUSED(pixels)
+    Q_UNUSED(count)
+    Q_UNUSED(color)
+
+    return 0;
+}
+
+#endif
+
+Nedrysoft::Ribbon::RibbonIconTinter::RibbonIconTinter() = default;
+
+auto Nedrysoft::Ribbon::RibbonIconTinter::getInstance() -> Nedrysoft::Ribbon::RibbonIconTinter * {
+    static RibbonIconTinter instance;
+
+    return &instance;
+}
+
+auto Nedrysoft::Ribbon::RibbonIconTinter::pixmap(
+        const QString &glyph,
+        QRgb color,
+        qreal devicePixelRatio) -> QPixmap {
+
+    auto scale = (devicePixelRatio>1) ? 2 : 1;
+
+    auto key = QString("%1:%2:%3")
+            .arg(glyph)
+            .arg(color, 8, 16, QChar('0'))
+            .arg(scale);
+
+    auto iterator = m_pixmaps.constFind(key);
+
+    if (iterator!=m_pixmaps.constEnd()) {
+        return iterator.value();
+    }
+
+    auto image = QImage(QString(":/Nedrysoft/Ribbon/icons/%1-light%2.png")
+            .arg(glyph)
+            .arg((scale==2) ? "@2x" : ""));
+
+    tint(image, color);
+
+    auto pixmap = QPixmap::fromImage(image);
+
+    pixmap.setDevicePixelRatio(scale);
+
+    m_pixmaps.insert(key, pixmap);
+
+    return pixmap;
+}
+
+auto Nedrysoft::Ribbon::RibbonIconTinter::clear() -> void {
+    m_pixmaps.clear();
+}
+
+auto Nedrysoft::Ribbon::RibbonIconTinter::tint(QImage &image, QRgb color) -> void {
+    if (image.isNull()) {
+        return;
+    }
+
+    if (image.format()!=QImage::Format_ARGB32_Premultiplied) {
+        image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+    }
+
+    auto premultipliedColor = qPremultiply(color);
+
+    for (auto y = 0; y<image.height(); y++) {
+        auto pixels = reinterpret_cast<quint32 *>(image.scanLine(y));
+        auto count = image.width();
+
+        // the vector kernel handles whole blocks of pixels, anything left over is recoloured by the scalar loop.
+
+        auto processed = tintVector(pixels, count, premultipliedColor);
+
+        tintScalar(pixels+processed, count-processed, premultipliedColor);
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONICONTINTER_H
+#define NEDRYSOFT_RIBBONICONTINTER_H
+
+#include "RibbonSpec.h"
+
+#include <QHash>
+#include <QImage>
+#include <QPixmap>
+#include <QString>
+
+namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The RibbonIconTinter generates themed glyphs from a single monochrome mask.
+     *
+     * @details     Instead of loading a light and a dark image for every glyph, the alpha channel of the mask is
+     *              used to recolour the glyph to the colour required by the current theme.  The recolour is
+     *              performed with SSE2 or NEON where available and the results are cached per glyph, colour and
+     *              device pixel ratio.  This class is a singleton and therefore cannot be instantiated directly,
+     *              the instance can be obtained using the getInstance() method.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonIconTinter {
+        private:
+            /**
+             * @brief       Constructs a new RibbonIconTinter.
+             *
+             * @note        Cannot be directly instantiated, this is a singleton class and the instance can be
+             *              accessed through the getInstance() method.
+             */
+            explicit RibbonIconTinter();
+
+            /**
+             * @brief       Delete the copy constructor.
+             */
+            RibbonIconTinter(const RibbonIconTinter&) = delete;
+
+            /**
+             * @brief       Delete the assignment operator.
+             */
+            RibbonIconTinter& operator=(const RibbonIconTinter&) = delete;
+
+        public:
+            /**
+             * @brief       Returns the singleton instance of the RibbonIconTinter class.
+             *
+             * @returns     the instance of the class.
+             */
+            static auto getInstance() -> Nedrysoft::Ribbon::RibbonIconTinter *;
+
+            /**
+             * @brief       Returns the glyph recoloured to the given colour.
+             *
+             * @note        The mask is loaded from the ribbon resources (the light variant of the glyph), the 2x
+             *              mask is used if the device pixel ratio is greater than 1.
+             *
+             * @param[in]   glyph the name of the glyph, i.e "arrow-drop".
+             * @param[in]   color the colour of the glyph.
+             * @param[in]   devicePixelRatio the device pixel ratio that the glyph will be drawn at.
+             *
+             * @returns     the tinted pixmap.
+             */
+            auto pixmap(const QString &glyph, QRgb color, qreal devicePixelRatio) -> QPixmap;
+
+            /**
+             * @brief       Removes all tinted glyphs from the cache.
+             */
+            auto clear() -> void;
+
+            /**
+             * @brief       Recolours an image, keeping only its alpha channel.
+             *
+             * @note        The image is converted to QImage::Format_ARGB32_Premultiplied if required.
+             *
+             * @param[in]   image the image to recolour.
+             * @param[in]   color the colour to apply.
+             */
+            static auto tint(QImage &image, QRgb color) -> void;
+
+        private:
+            //! @cond
+
+            QHash<QString, QPixmap> m_pixmaps;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONICONTINTER_H
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonInstrumentation.h"
+
+#include <QFile>
+#include <QTextStream>
+#include <algorithm>
+
+constexpr auto MaximumTraceEvents = 1000000;
+
+Nedrysoft::Ribbon::RibbonInstrumentation::RibbonInstrumentation() :
+        m_traceEnabled(false) {
+
+    m_timer.start();
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::getInstance() -> Nedrysoft::Ribbon::RibbonInstrumentation * {
+    static RibbonInstrumentation instance;
+
+    return &instance;
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::isCompiledIn() -> bool {
+#if defined(NEDRYSOFT_RIBBON_INSTRUMENTATION)
+    return true;
+#else
+    return false;
+#endif
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::categoryName(Category category) -> QString {
+    switch(category) {
+        case Paint: {
+            return QStringLiteral("paint");
+        }
+
+        case StyleSheet: {
+            return QStringLiteral("stylesheet");
+        }
+
+        case Polish: {
+            return QStringLiteral("polish");
+        }
+
+        case Layout: {
+            return QStringLiteral("layout");
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    return QString();
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::timestamp() const -> qint64 {
+    return m_timer.nsecsElapsed();
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::record(
+        const char *className,
+        Category category,
+        qint64 start,
+        qint64 duration) -> void {
+
+    auto iterator = m_statistics.find(className);
+
+    if (iterator==m_statistics.end()) {
+        std::array<Statistic, CategoryCount> statistics;
+
+        for (auto index = 0; index<CategoryCount; index++) {
+            statistics[index] = Statistic{QString::fromLatin1(className), static_cast<Category>(index), 0, 0, 0};
+        }
+
+        iterator = m_statistics.insert(className, statistics);
+    }
+
+    auto &statistic = (*iterator)[category];
+
+    statistic.count++;
+    statistic.totalTime += duration;
+    statistic.maxTime = qMax(statistic.maxTime, duration);
+
+    if ((m_traceEnabled) && (m_traceEvents.count()<MaximumTraceEvents)) {
+        m_traceEvents.append(TraceEvent{className, category, start, duration});
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::statistics() -> QList<Statistic> {
+    QList<Statistic> statistics;
+
+    for (auto &classStatistics : m_statistics) {
+        for (auto &statistic : classStatistics) {
+            if (statistic.count) {
+                statistics.append(statistic);
+            }
+        }
+    }
+
+    std::sort(statistics.begin(), statistics.end(), [](const Statistic &a, const Statistic &b) {
+        return a.totalTime>b.totalTime;
+    });
+
+    return statistics;
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::reset() -> void {
+    m_statistics.clear();
+    m_traceEvents.clear();
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::setTraceEnabled(bool enabled) -> void {
+    m_traceEnabled = enabled;
+}
+
+auto Nedrysoft::Ribbon::RibbonInstrumentation::writeTrace(const QString &filename) -> bool {
+    QFile file(filename);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+
+    // the trace is written directly rather than through QJsonDocument as it may contain a large number of events.
+
+    QTextStream stream(&file);
+
+    stream << "{\"traceEvents\":[";
+
+    for (auto index = 0; index<m_traceEvents.count(); index++) {
+        auto &event = m_traceEvents.at(index);
+
+        if (index) {
+            stream << ",";
+        }
+
+        stream << "\n{\"name\":\"" << event.className << "\","
+               << "\"cat\":\"" << categoryName(event.category) << "\","
+               << "\"ph\":\"X\","
+               << "\"ts\":" << QString::number(static_cast<double>(event.start)/1000.0, 'f', 3) << ","
+               << "\"dur\":" << QString::number(static_cast<double>(event.duration)/1000.0, 'f', 3) << ","
+               << "\"pid\":1,\"tid\":1}";
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    stream.flush();
+
+    return file.error()==QFile::NoError;
+}
+
+Nedrysoft::Ribbon::RibbonScopeTimer::RibbonScopeTimer(
+        const char *className,
+        Nedrysoft::Ribbon::RibbonInstrumentation::Category category) :
+            m_className(className),
+            m_category(category),
+            m_start(RibbonInstrumentation::getInstance()->timestamp()) {
+
+}
+
+Nedrysoft::Ribbon::RibbonScopeTimer::~RibbonScopeTimer() {
+    auto instrumentation = RibbonInstrumentation::getInstance();
+
+    instrumentation->record(m_className, m_category, m_start, instrumentation->timestamp()-m_start);
+}
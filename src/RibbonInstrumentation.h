@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONINSTRUMENTATION_H
+#define NEDRYSOFT_RIBBONINSTRUMENTATION_H
+
+#include "RibbonSpec.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QVector>
+#include <array>
+
+/**
+ * @brief       Instrumentation macros, these compile to nothing unless NEDRYSOFT_RIBBON_INSTRUMENTATION is defined.
+ *
+ * @details     NEDRYSOFT_RIBBON_MEASURE times the enclosing scope against the class of the current QObject,
+ *              NEDRYSOFT_RIBBON_MEASURE_CLASS times the enclosing scope against the given class name.
+ */
+#if defined(NEDRYSOFT_RIBBON_INSTRUMENTATION)
+#define NEDRYSOFT_RIBBON_MEASURE(category) \
+    Nedrysoft::Ribbon::RibbonScopeTimer ribbonScopeTimer( \
+            metaObject()->className(), \
+            Nedrysoft::Ribbon::RibbonInstrumentation::category)
+
+#define NEDRYSOFT_RIBBON_MEASURE_CLASS(className, category) \
+    Nedrysoft::Ribbon::RibbonScopeTimer ribbonScopeTimer( \
+            className, \
+            Nedrysoft::Ribbon::RibbonInstrumentation::category)
+#else
+#define NEDRYSOFT_RIBBON_MEASURE(category)
+#define NEDRYSOFT_RIBBON_MEASURE_CLASS(className, category)
+#endif
+
+namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The RibbonInstrumentation class collects paint, stylesheet, polish and layout timings.
+     *
+     * @details     Timings are recorded per widget class by the instrumentation macros, which are only compiled in
+     *              when the library is built with NEDRYSOFT_RIBBON_INSTRUMENTATION.  Timings are inclusive, so a
+     *              polish which happens during a stylesheet update is counted in both.  When tracing is enabled
+     *              each measurement is also kept so that it can be written as a Chrome trace event file.
+     *
+     *              This class is a singleton and therefore cannot be instantiated directly the instance can be
+     *              obtained using the getInstance() method.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonInstrumentation {
+        public:
+            /**
+             * @brief       The categories of measurements.
+             */
+            enum Category {
+                Paint = 0,                                                      /**< Painting the widget. */
+                StyleSheet = 1,                                                 /**< Updating the widget theme. */
+                Polish = 2,                                                     /**< Polishing the widget. */
+                Layout = 3,                                                     /**< Laying out the widget. */
+                CategoryCount = 4
+            };
+
+            /**
+             * @brief       The accumulated measurements of a category for a widget class.
+             */
+            struct Statistic {
+                QString className;
+                Category category;
+                quint64 count;
+                qint64 totalTime;
+                qint64 maxTime;
+            };
+
+        private:
+            /**
+             * @brief       Constructs a new RibbonInstrumentation.
+             *
+             * @note        Cannot be directly instantiated, this is a singleton class and the instance can be
+             *              accessed through the getInstance() method.
+             */
+            explicit RibbonInstrumentation();
+
+            /**
+             * @brief       Delete the copy constructor.
+             */
+            RibbonInstrumentation(const RibbonInstrumentation&) = delete;
+
+            /**
+             * @brief       Delete the assignment operator.
+             */
+            RibbonInstrumentation& operator=(const RibbonInstrumentation&) = delete;
+
+        public:
+            /**
+             * @brief       Returns the singleton instance of the RibbonInstrumentation class.
+             *
+             * @returns     the instance of the class
+             */
+            static auto getInstance() -> Nedrysoft::Ribbon::RibbonInstrumentation *;
+
+            /**
+             * @brief       Returns whether the instrumentation was compiled into the library.
+             *
+             * @returns     true if NEDRYSOFT_RIBBON_INSTRUMENTATION was defined; otherwise false.
+             */
+            static auto isCompiledIn() -> bool;
+
+            /**
+             * @brief       Returns the name of a category.
+             *
+             * @param[in]   category the category.
+             *
+             * @returns     the category name.
+             */
+            static auto categoryName(Category category) -> QString;
+
+            /**
+             * @brief       Returns the time since the instrumentation was started.
+             *
+             * @returns     the time in nanoseconds.
+             */
+            auto timestamp() const -> qint64;
+
+            /**
+             * @brief       Records a measurement.
+             *
+             * @param[in]   className the class name of the widget, must remain valid for the lifetime of the
+             *              application (i.e. from QMetaObject::className()).
+             * @param[in]   category the category of the measurement.
+             * @param[in]   start the timestamp at the start of the measurement.
+             * @param[in]   duration the duration of the measurement in nanoseconds.
+             */
+            auto record(const char *className, Category category, qint64 start, qint64 duration) -> void;
+
+            /**
+             * @brief       Returns the accumulated measurements, ordered by total time, highest first.
+             *
+             * @returns     the statistics.
+             */
+            auto statistics() -> QList<Nedrysoft::Ribbon::RibbonInstrumentation::Statistic>;
+
+            /**
+             * @brief       Discards all measurements and trace events.
+             */
+            auto reset() -> void;
+
+            /**
+             * @brief       Sets whether individual measurements are kept for tracing.
+             *
+             * @note        Tracing is disabled by default, at most 1,000,000 events are kept.
+             *
+             * @param[in]   enabled true if tracing is enabled; otherwise false.
+             */
+            auto setTraceEnabled(bool enabled) -> void;
+
+            /**
+             * @brief       Writes the trace events as a Chrome trace event file.
+             *
+             * @note        The file can be loaded with chrome://tracing or https://ui.perfetto.dev.
+             *
+             * @param[in]   filename the file to write.
+             *
+             * @returns     true if the file was written; otherwise false.
+             */
+            auto writeTrace(const QString &filename) -> bool;
+
+        private:
+            //! @cond
+
+            struct TraceEvent {
+                const char *className;
+                Category category;
+                qint64 start;
+                qint64 duration;
+            };
+
+            QElapsedTimer m_timer;
+            QHash<const char *, std::array<Statistic, CategoryCount> > m_statistics;
+            QVector<TraceEvent> m_traceEvents;
+            bool m_traceEnabled;
+
+            //! @endcond
+    };
+
+    /**
+     * @brief       The RibbonScopeTimer records the time spent in the enclosing scope.
+     *
+     * @note        Use the NEDRYSOFT_RIBBON_MEASURE macros rather than this class directly so that the measurement
+     *              is compiled out when instrumentation is disabled.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonScopeTimer {
+        public:
+            /**
+             * @brief       Constructs a new RibbonScopeTimer and starts timing.
+             *
+             * @param[in]   className the class name of the widget being measured.
+             * @param[in]   category the category of the measurement.
+             */
+            RibbonScopeTimer(const char *className, Nedrysoft::Ribbon::RibbonInstrumentation::Category category);
+
+            /**
+             * @brief       Destroys the RibbonScopeTimer, recording the measurement.
+             */
+            ~RibbonScopeTimer();
+
+        private:
+            //! @cond
+
+            const char *m_className;
+            Nedrysoft::Ribbon::RibbonInstrumentation::Category m_category;
+            qint64 m_start;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONINSTRUMENTATION_H
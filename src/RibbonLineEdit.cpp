@@ -23,6 +23,11 @@
 
 #include "RibbonLineEdit.h"
 
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
+
 #include <QApplication>
 #include <QMimeData>
 #include <QPainter>
@@ -52,7 +57,9 @@ Nedrysoft::Ribbon::RibbonLineEdit::RibbonLineEdit(QWidget *parent) :
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheet(isDarkMode);
     });
 
@@ -151,16 +158,38 @@ Nedrysoft::Ribbon::RibbonLineEdit::~RibbonLineEdit() {
 }
 
 auto Nedrysoft::Ribbon::RibbonLineEdit::updateStyleSheet(bool isDarkMode) -> void {
-    QString styleSheet(ThemeStylesheet);
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
 
-    styleSheet.replace("[border]", "border: 0px none");
+    if (RibbonStyle::isActive()) {
+        // the palette is derived from the theme when the widget is polished.
 
-    if (isDarkMode) {
-        styleSheet.replace("[background-colour]", "background-color: #434343");
-    } else {
-        styleSheet.replace("[background-colour]", "background-color: #ffffff");
+        style()->polish(this);
+
+        update();
+
+        return;
     }
 
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
+
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        styleSheet.replace("[border]", "border: 0px none");
+
+        if (isDarkMode) {
+            styleSheet.replace("[background-colour]", "background-color: #434343");
+        } else {
+            styleSheet.replace("[background-colour]", "background-color: #ffffff");
+        }
+
+        return styleSheet;
+    });
+
     setStyleSheet(styleSheet);
 }
 
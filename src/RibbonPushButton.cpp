@@ -24,82 +24,61 @@
 #include "RibbonPushButton.h"
 
 #include "RibbonFontManager.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonThemeDispatcher.h"
 #include "RibbonWidget.h"
 
-#include <QApplication>
-#include <QStyle>
+#include <QCursor>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPaintEvent>
 
-constexpr auto ThemeStylesheet = R"(
-    QPushButton {
-        border: 0px;
-        padding: 3px;
-        border-radius: none;
-    }
+constexpr auto ButtonPadding = 3;
 
-    QPushButton::hover {
-        background: [background-colour];
-    }
-)";
+static auto eventPosition(QMouseEvent *mouseEvent) -> QPoint {
+#if (QT_VERSION_MAJOR>=6)
+    return mouseEvent->position().toPoint();
+#else
+    return mouseEvent->pos();
+#endif
+}
 
 Nedrysoft::Ribbon::RibbonPushButton::RibbonPushButton(QWidget *parent) :
         QWidget(parent),
-        m_iconSize(QSize(RibbonPushButtonDefaultIconWidth, RibbonPushButtonDefaultIconHeight)) {
-
-    m_layout = new QVBoxLayout;
-    m_mainButton = new QPushButton;
-    m_buttonLabel = new QLabel;
-
-    m_buttonLabel->setAlignment(Qt::AlignHCenter);
+        m_iconSize(QSize(RibbonPushButtonDefaultIconWidth, RibbonPushButtonDefaultIconHeight)),
+        m_hovered(false),
+        m_pressed(false) {
 
     auto fontManager = RibbonFontManager::getInstance();
 
-    auto font = QFont(fontManager->normalFont(), RibbonPushButtonDefaultFontSize);
-
-    m_mainButton->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
-    m_buttonLabel->setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
-
-    m_mainButton->installEventFilter(this);
-
-    m_buttonLabel->setFont(font);
-
-    m_layout->addWidget(m_mainButton);
-    m_layout->addWidget(m_buttonLabel);
-    m_layout->addSpacerItem(new QSpacerItem(0,0, QSizePolicy::Minimum, QSizePolicy::MinimumExpanding));
+    m_font = fontManager->font(FontRole::Normal, RibbonPushButtonDefaultFontSize);
 
-    m_layout->setContentsMargins(0,0,0,0);
-    m_layout->setSpacing(0);
+    setMouseTracking(true);
 
-    m_mainButton->setFlat(true);
+    setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
 
-    setLayout(m_layout);
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
 
-    connect(m_mainButton, &QPushButton::clicked, [=] (bool checked) {
-        Q_EMIT clicked();
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
+        updateColors(isDarkMode);
     });
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
-        updateStyleSheets(isDarkMode);
-    });
-
-    updateSizes();
-
-    updateStyleSheets(themeSupport->isDarkMode());
+    updateColors(themeSupport->isDarkMode());
 }
 
 Nedrysoft::Ribbon::RibbonPushButton::~RibbonPushButton() {
-    m_mainButton->deleteLater();
-    m_buttonLabel->deleteLater();
-    m_layout->deleteLater();
 }
 
 auto Nedrysoft::Ribbon::RibbonPushButton::icon() -> QIcon {
-    return m_mainButton->icon();
+    return m_icon;
 }
 
 auto Nedrysoft::Ribbon::RibbonPushButton::setIcon(QIcon &icon) -> void {
-    m_mainButton->setIcon(icon);
+    m_icon = icon;
+
+    update(buttonRect());
 }
 
 auto Nedrysoft::Ribbon::RibbonPushButton::iconSize() -> QSize {
@@ -110,52 +89,168 @@ auto Nedrysoft::Ribbon::RibbonPushButton::setIconSize(QSize iconSize) -> void
 {
     m_iconSize = iconSize;
 
-    updateSizes();
+    updateGeometry();
+    update();
 }
 
 auto Nedrysoft::Ribbon::RibbonPushButton::text() -> QString {
-    return m_buttonLabel->text();
+    return m_text;
 }
 
 auto Nedrysoft::Ribbon::RibbonPushButton::setText(QString text) -> void {
-    m_buttonLabel->setText(text);
+    m_text = text;
+
+    updateGeometry();
+    update();
+}
+
+auto Nedrysoft::Ribbon::RibbonPushButton::sizeHint() const -> QSize {
+    auto fontManager = RibbonFontManager::getInstance();
 
-    m_buttonLabel->setVisible(!m_buttonLabel->text().isEmpty());
+    auto size = m_iconSize+QSize(ButtonPadding*2, ButtonPadding*2);
+
+    if (!m_text.isEmpty()) {
+        auto fontMetrics = fontManager->fontMetrics(FontRole::Normal, RibbonPushButtonDefaultFontSize);
+
+        size.setWidth(qMax(size.width(), fontMetrics.boundingRect(m_text).width()));
+
+        size.rheight() += fontMetrics.height();
+    }
+
+    return size;
 }
 
-auto Nedrysoft::Ribbon::RibbonPushButton::updateSizes() -> void {
-    m_mainButton->setMinimumSize(m_iconSize);
-    m_mainButton->setIconSize(m_iconSize);
+auto Nedrysoft::Ribbon::RibbonPushButton::minimumSizeHint() const -> QSize {
+    return sizeHint();
 }
 
-auto Nedrysoft::Ribbon::RibbonPushButton::updateStyleSheets(bool isDarkMode) -> void {
-    Q_UNUSED(isDarkMode)
+auto Nedrysoft::Ribbon::RibbonPushButton::updateColors(bool isDarkMode) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
 
-    QString styleSheet(ThemeStylesheet);
+    auto theme = isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light;
 
-    auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+    // the main button only has a background when it is hovered over or pressed.
+
+    m_stateColors[Normal] = QColor();
+    m_stateColors[Hover] = QColor(Nedrysoft::Ribbon::PushButtonColor[theme]);
+    m_stateColors[Pressed] = QColor(Nedrysoft::Ribbon::PushButtonPressedColor[theme]);
+
+    update(buttonRect());
+}
 
-    styleSheet.replace("[background-colour]", themeSupport->getColor(Nedrysoft::Ribbon::PushButtonColor).name());
+auto Nedrysoft::Ribbon::RibbonPushButton::buttonState() const -> ButtonState {
+    if (m_hovered) {
+        return m_pressed ? Pressed : Hover;
+    }
+
+    return Normal;
+}
 
-    m_mainButton->setStyleSheet(styleSheet);
-    m_buttonLabel->setStyleSheet(styleSheet);
+auto Nedrysoft::Ribbon::RibbonPushButton::buttonRect() const -> QRect {
+    return QRect(0, 0, width(), m_iconSize.height()+(ButtonPadding*2));
 }
 
-auto Nedrysoft::Ribbon::RibbonPushButton::eventFilter(QObject *object, QEvent *event) -> bool {
-    if (event->type()==QEvent::MouseButtonPress) {
-        QString styleSheet(ThemeStylesheet);
+auto Nedrysoft::Ribbon::RibbonPushButton::updateHover(const QPoint &position) -> void {
+    auto hovered = buttonRect().contains(position);
 
-        styleSheet.replace("[background-colour]", "#292929");
+    if (hovered!=m_hovered) {
+        m_hovered = hovered;
 
-        //TODO: light mode
+        update(buttonRect());
+    }
+}
 
-        m_mainButton->setStyleSheet(styleSheet);
-    } else if (event->type()==QEvent::MouseButtonRelease) {
-        auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+auto Nedrysoft::Ribbon::RibbonPushButton::event(QEvent *event) -> bool {
+    switch(event->type()) {
+        case QEvent::Enter: {
+            updateHover(mapFromGlobal(QCursor::pos()));
 
-        updateStyleSheets(themeSupport->isDarkMode());
+            break;
+        }
+
+        case QEvent::Leave: {
+            updateHover(QPoint(-1, -1));
+
+            break;
+        }
+
+        default: {
+            break;
+        }
     }
 
-    return false;
+    return QWidget::event(event);
 }
 
+auto Nedrysoft::Ribbon::RibbonPushButton::mousePressEvent(QMouseEvent *event) -> void {
+    if ((event->button()!=Qt::LeftButton) || (!buttonRect().contains(eventPosition(event)))) {
+        QWidget::mousePressEvent(event);
+
+        return;
+    }
+
+    m_pressed = true;
+
+    update(buttonRect());
+}
+
+auto Nedrysoft::Ribbon::RibbonPushButton::mouseMoveEvent(QMouseEvent *event) -> void {
+    // while the button is held down, the pressed state follows the mouse in and out of the button.
+
+    updateHover(eventPosition(event));
+
+    QWidget::mouseMoveEvent(event);
+}
+
+auto Nedrysoft::Ribbon::RibbonPushButton::mouseReleaseEvent(QMouseEvent *event) -> void {
+    if ((event->button()!=Qt::LeftButton) || (!m_pressed)) {
+        QWidget::mouseReleaseEvent(event);
+
+        return;
+    }
+
+    m_pressed = false;
+
+    update(buttonRect());
+
+    if (buttonRect().contains(eventPosition(event))) {
+        Q_EMIT clicked();
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonPushButton::paintEvent(QPaintEvent *event) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(Paint);
+
+    QPainter painter(this);
+
+    auto buttonRect = this->buttonRect();
+
+    auto &backgroundColor = m_stateColors[buttonState()];
+
+    if (backgroundColor.isValid()) {
+        painter.fillRect(buttonRect, backgroundColor);
+    }
+
+    if (!m_icon.isNull()) {
+        auto iconRect = QRect(QPoint(0, 0), m_iconSize);
+
+        iconRect.moveCenter(buttonRect.center());
+
+        m_icon.paint(&painter, iconRect, Qt::AlignCenter, isEnabled() ? QIcon::Normal : QIcon::Disabled);
+    }
+
+    // a press or hover change only repaints the button rect, so the caption is skipped unless it is dirty.
+
+    if ((!m_text.isEmpty()) && (event->rect().bottom()>buttonRect.bottom())) {
+        auto fontManager = RibbonFontManager::getInstance();
+
+        auto fontMetrics = fontManager->fontMetrics(FontRole::Normal, RibbonPushButtonDefaultFontSize);
+
+        auto textRect = QRect(0, buttonRect.bottom()+1, width(), fontMetrics.height());
+
+        painter.setFont(m_font);
+        painter.setPen(palette().color(isEnabled() ? QPalette::Active : QPalette::Disabled, QPalette::WindowText));
+
+        painter.drawText(textRect, Qt::AlignHCenter | Qt::AlignTop, m_text);
+    }
+}
@@ -26,9 +26,9 @@
 
 #include "RibbonSpec.h"
 
-#include <QLabel>
-#include <QPushButton>
-#include <QVBoxLayout>
+#include <QColor>
+#include <QFont>
+#include <QIcon>
 #include <QWidget>
 #include <ThemeSupport>
 
@@ -40,7 +40,8 @@ namespace Nedrysoft { namespace Ribbon {
     /**
      * @brief       The RibbonPushButton widget provides a ribbon stylised push button with icon and optional text.
      *
-     * @details     A PushButton widget that is styled to match the RibbonBar.
+     * @details     A PushButton widget that is styled to match the RibbonBar, the icon and text are painted by the
+     *              widget itself rather than by child widgets.
      */
     class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonPushButton :
             public QWidget {
@@ -107,25 +108,65 @@ namespace Nedrysoft { namespace Ribbon {
             /**
              * @brief       Sets the text that is displayed under the main button.
              *
-             * @note        If the text is empty, then the RibbonPushButton modifies the layout so that the space
-             *              that would contain the text is removed.
+             * @note        If the text is empty, then the RibbonPushButton removes the space that would contain
+             *              the text.
              *
              * @param[in]   text the text that is displayed under the main button.
              */
             auto setText(QString text) -> void;
 
+            /**
+             * @brief       Reimplements: QWidget::sizeHint().
+             *
+             * @returns     the recommended size of the widget.
+             */
+            auto sizeHint() const -> QSize override;
+
+            /**
+             * @brief       Reimplements: QWidget::minimumSizeHint().
+             *
+             * @returns     the minimum size of the widget.
+             */
+            auto minimumSizeHint() const -> QSize override;
+
         private:
             /**
-             * @brief       Updates the child widgets when the size of the icon is changed.
+             * @brief       The visual states of the main button.
              */
-            auto updateSizes() -> void;
+            enum ButtonState {
+                Normal = 0,
+                Hover = 1,
+                Pressed = 2,
+                StateCount = 3
+            };
 
             /**
-             * @brief       Updates the child widgets stylesheets when the operating system theme is changed.
+             * @brief       Computes the background colours of each button state when the theme is changed.
              *
              * @param[in]   isDarkMode true if dark mode; otherwise false.
              */
-            auto updateStyleSheets(bool isDarkMode) -> void;
+            auto updateColors(bool isDarkMode) -> void;
+
+            /**
+             * @brief       Returns the current visual state of the main button.
+             *
+             * @returns     the button state.
+             */
+            auto buttonState() const -> ButtonState;
+
+            /**
+             * @brief       Returns the rectangle of the main button (the icon area) in widget coordinates.
+             *
+             * @returns     the button rectangle.
+             */
+            auto buttonRect() const -> QRect;
+
+            /**
+             * @brief       Updates the hover state from the given mouse position and repaints if it has changed.
+             *
+             * @param[in]   position the mouse position in widget coordinates.
+             */
+            auto updateHover(const QPoint &position) -> void;
 
         public:
             /**
@@ -135,20 +176,54 @@ namespace Nedrysoft { namespace Ribbon {
 
         protected:
             /**
-             * @brief       Reimplements: QWidget::eventFilter(QObject *object, QEvent *event).
+             * @brief       Reimplements: QWidget::event(QEvent *event).
+             *
+             * @note        Used to track the mouse entering and leaving the widget.
+             *
+             * @param[in]   event the event information.
+             *
+             * @returns     true if event handled; otherwise false.
+             */
+            auto event(QEvent *event) -> bool override;
+
+            /**
+             * @brief       Reimplements: QWidget::paintEvent(QPaintEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto paintEvent(QPaintEvent *event) -> void override;
+
+            /**
+             * @brief       Reimplements: QWidget::mousePressEvent(QMouseEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto mousePressEvent(QMouseEvent *event) -> void override;
+
+            /**
+             * @brief       Reimplements: QWidget::mouseMoveEvent(QMouseEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto mouseMoveEvent(QMouseEvent *event) -> void override;
+
+            /**
+             * @brief       Reimplements: QWidget::mouseReleaseEvent(QMouseEvent *event).
              *
-             * @param[in]   object the target object for the event.
              * @param[in]   event the event information.
              */
-            auto eventFilter(QObject *object, QEvent *event) -> bool override;
+            auto mouseReleaseEvent(QMouseEvent *event) -> void override;
 
         private:
             //! @cond
 
-            QVBoxLayout *m_layout;
-            QPushButton *m_mainButton;
-            QLabel *m_buttonLabel;
+            QIcon m_icon;
             QSize m_iconSize;
+            QString m_text;
+            QFont m_font;
+            QColor m_stateColors[StateCount];
+            bool m_hovered;
+            bool m_pressed;
 
             //! @endcond
     };
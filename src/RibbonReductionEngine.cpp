@@ -0,0 +1,440 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonReductionEngine.h"
+
+#include "RibbonGroup.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonPushButton.h"
+
+#include <QChildEvent>
+#include <QEvent>
+#include <QHBoxLayout>
+#include <QTimer>
+
+constexpr auto CollapsedIconSize = 32;
+
+Nedrysoft::Ribbon::RibbonReductionEngine::RibbonReductionEngine(QWidget *page) :
+        QObject(page),
+        m_container(nullptr),
+        m_fixedWidth(0),
+        m_measured(false),
+        m_invalidateScheduled(false) {
+
+    // the groups are normally direct children of the page, but a lazy page wraps them in a placeholder.
+
+    auto group = page->findChild<RibbonGroup *>();
+
+    if (!group) {
+        return;
+    }
+
+    m_container = group->parentWidget();
+    m_layout = qobject_cast<QBoxLayout *>(m_container->layout());
+
+    if (!m_layout) {
+        m_container = nullptr;
+
+        return;
+    }
+
+    m_container->installEventFilter(this);
+
+    // a page that has not been shown yet does not have its real width, it is reduced when it is first resized.
+
+    if ((m_container->isVisible()) && (m_container->width()>0)) {
+        reduce(m_container->width());
+    }
+}
+
+Nedrysoft::Ribbon::RibbonReductionEngine::~RibbonReductionEngine() {
+    // if the page is being destroyed the layout has already gone and there is nothing to restore.
+
+    if (!m_layout) {
+        return;
+    }
+
+    for (auto index = 0; index<m_groups.count(); index++) {
+        setVariant(index, Expanded);
+
+        if (m_groups[index].collapsedGroup) {
+            m_groups[index].collapsedGroup->deleteLater();
+        }
+
+        if (m_groups[index].popup) {
+            m_groups[index].popup->deleteLater();
+        }
+    }
+
+    m_container->setMinimumWidth(0);
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::isValid() -> bool {
+    return m_layout!=nullptr;
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::invalidate() -> void {
+    m_measured = false;
+    m_solutions.clear();
+
+    if ((m_container) && (m_container->isVisible()) && (m_container->width()>0)) {
+        reduce(m_container->width());
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::measure() -> void {
+    // restore any collapsed groups so that the layout only contains the real groups.
+
+    for (auto index = 0; index<m_groups.count(); index++) {
+        setVariant(index, Expanded);
+    }
+
+    auto previousGroups = m_groups;
+
+    m_groups.clear();
+
+    auto margins = m_layout->contentsMargins();
+    auto visibleItems = 0;
+
+    m_fixedWidth = margins.left()+margins.right();
+
+    for (auto itemIndex = 0; itemIndex<m_layout->count(); itemIndex++) {
+        auto item = m_layout->itemAt(itemIndex);
+        auto group = qobject_cast<RibbonGroup *>(item->widget());
+
+        if (item->isEmpty()) {
+            continue;
+        }
+
+        visibleItems++;
+
+        if (!group) {
+            m_fixedWidth += item->minimumSize().width();
+
+            continue;
+        }
+
+        Group entry{group, nullptr, nullptr, {}, Expanded};
+
+        // a change to the contents or name of the group invalidates its layout, which is watched for.
+
+        group->installEventFilter(this);
+
+        for (auto &previous : previousGroups) {
+            if (previous.group==group) {
+                entry.collapsedGroup = previous.collapsedGroup;
+                entry.popup = previous.popup;
+            }
+        }
+
+        m_groups.append(entry);
+    }
+
+    if (visibleItems>1) {
+        m_fixedWidth += m_layout->spacing()*(visibleItems-1);
+    }
+
+    auto minimumWidth = m_fixedWidth;
+
+    for (auto index = 0; index<m_groups.count(); index++) {
+        auto &entry = m_groups[index];
+
+        if (!entry.collapsedGroup) {
+            createCollapsedGroup(index);
+        } else {
+            updateCollapsedGroup(index);
+        }
+
+        entry.widths.resize(VariantCount);
+
+        entry.widths[Expanded] = qMax(entry.group->sizeHint().width(), entry.group->minimumSizeHint().width());
+        entry.widths[Collapsed] = entry.collapsedGroup->sizeHint().width();
+
+        // a group that is already narrower than its collapsed form is never collapsed.
+
+        if (entry.widths[Collapsed]>=entry.widths[Expanded]) {
+            entry.widths.resize(Collapsed);
+        }
+
+        minimumWidth += entry.widths.last();
+    }
+
+    // allow the page to shrink to the width of the fully reduced groups rather than the full size of its layout.
+
+    m_container->setMinimumWidth(minimumWidth);
+
+    m_measured = true;
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::solve(int availableWidth) -> QVector<int> {
+    if (!m_layout) {
+        return QVector<int>();
+    }
+
+    if (!m_measured) {
+        measure();
+    }
+
+    auto bucket = availableWidth/RibbonReductionWidthBucket;
+
+    auto iterator = m_solutions.constFind(bucket);
+
+    if (iterator!=m_solutions.constEnd()) {
+        return iterator.value();
+    }
+
+    // solve for the lower edge of the bucket so the solution fits every width within it.
+
+    auto budget = (bucket*RibbonReductionWidthBucket)-m_fixedWidth;
+    auto variants = QVector<int>(m_groups.count(), Expanded);
+    auto totalWidth = 0;
+
+    for (auto &entry : m_groups) {
+        totalWidth += entry.widths[Expanded];
+    }
+
+    // each pass reduces every group by one variant, starting with the rightmost group, until the groups fit.
+
+    for (auto variant = Expanded+1; variant<VariantCount; variant++) {
+        for (auto index = m_groups.count()-1; (index>=0) && (totalWidth>budget); index--) {
+            auto &widths = m_groups[index].widths;
+
+            if (variant<widths.count()) {
+                totalWidth -= widths[variant-1]-widths[variant];
+
+                variants[index] = variant;
+            }
+        }
+    }
+
+    m_solutions.insert(bucket, variants);
+
+    return variants;
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::reduce(int availableWidth) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(Layout);
+
+    auto variants = solve(availableWidth);
+
+    for (auto index = 0; index<variants.count(); index++) {
+        setVariant(index, variants[index]);
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::setVariant(int index, int variant) -> void {
+    auto &entry = m_groups[index];
+
+    if ((entry.variant==variant) || (!entry.group) || (!entry.collapsedGroup)) {
+        return;
+    }
+
+    entry.variant = variant;
+
+    switch(variant) {
+        case Expanded: {
+            if (entry.popup) {
+                entry.popup->hide();
+            }
+
+            // replacing the collapsed group moves the group back out of the popup.
+
+            m_layout->replaceWidget(entry.collapsedGroup, entry.group);
+
+            entry.collapsedGroup->hide();
+            entry.group->show();
+
+            break;
+        }
+
+        case Collapsed: {
+            m_layout->replaceWidget(entry.group, entry.collapsedGroup);
+
+            entry.group->hide();
+            entry.collapsedGroup->show();
+
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::createCollapsedGroup(int index) -> void {
+    auto &entry = m_groups[index];
+
+    auto collapsedGroup = new RibbonGroup(m_container);
+    auto layout = new QHBoxLayout(collapsedGroup);
+    auto button = new RibbonPushButton;
+
+    // the name of the group is shown on the button, so the collapsed group has no caption of its own.
+
+    collapsedGroup->setGroupName(QString());
+    collapsedGroup->hide();
+
+    button->setIconSize(QSize(CollapsedIconSize, CollapsedIconSize));
+
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(button);
+
+    auto group = entry.group;
+
+    connect(button, &RibbonPushButton::clicked, this, [=]() {
+        for (auto groupIndex = 0; groupIndex<m_groups.count(); groupIndex++) {
+            if (m_groups[groupIndex].group==group) {
+                showPopup(groupIndex);
+            }
+        }
+    });
+
+    entry.collapsedGroup = collapsedGroup;
+
+    updateCollapsedGroup(index);
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::updateCollapsedGroup(int index) -> void {
+    auto &entry = m_groups[index];
+
+    if ((!entry.group) || (!entry.collapsedGroup)) {
+        return;
+    }
+
+    auto button = entry.collapsedGroup->findChild<RibbonPushButton *>();
+
+    if (!button) {
+        return;
+    }
+
+    auto icon = entry.group->collapsedIcon();
+
+    button->setIcon(icon);
+    button->setText(entry.group->groupName());
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::showPopup(int index) -> void {
+    auto &entry = m_groups[index];
+
+    if (!entry.popup) {
+        entry.popup = new QFrame(m_container, Qt::Popup);
+
+        auto layout = new QHBoxLayout(entry.popup);
+
+        layout->setContentsMargins(0, 0, 0, 0);
+    }
+
+    if (entry.group->parentWidget()!=entry.popup) {
+        entry.popup->layout()->addWidget(entry.group);
+    }
+
+    entry.group->show();
+
+    entry.popup->adjustSize();
+    entry.popup->move(entry.collapsedGroup->mapToGlobal(QPoint(0, entry.collapsedGroup->height())));
+    entry.popup->show();
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::scheduleInvalidate() -> void {
+    if (m_invalidateScheduled) {
+        return;
+    }
+
+    m_invalidateScheduled = true;
+
+    QTimer::singleShot(0, this, [=]() {
+        m_invalidateScheduled = false;
+
+        invalidate();
+    });
+}
+
+auto Nedrysoft::Ribbon::RibbonReductionEngine::eventFilter(QObject *watched, QEvent *event) -> bool {
+    if (watched==m_container) {
+        switch(event->type()) {
+            case QEvent::Resize: {
+                reduce(m_container->width());
+
+                break;
+            }
+
+            case QEvent::ChildAdded: {
+                // groups that are moved back from a popup are already known, collapsed groups are still being
+                // constructed when they are added and are not yet RibbonGroups.
+
+                auto group = qobject_cast<RibbonGroup *>(static_cast<QChildEvent *>(event)->child());
+
+                if (!group) {
+                    break;
+                }
+
+                for (auto &entry : m_groups) {
+                    if ((entry.group==group) || (entry.collapsedGroup==group)) {
+                        return false;
+                    }
+                }
+
+                scheduleInvalidate();
+
+                break;
+            }
+
+            default: {
+                break;
+            }
+        }
+
+        return false;
+    }
+
+    if (event->type()==QEvent::LayoutRequest) {
+        // moving a group between the page and its popup also requests a layout, so the measurements are only
+        // invalidated if the group has been renamed (which changes its collapsed button) or its width has changed.
+
+        for (auto &entry : m_groups) {
+            if ((entry.group!=watched) || (entry.widths.isEmpty())) {
+                continue;
+            }
+
+            auto button = entry.collapsedGroup ? entry.collapsedGroup->findChild<RibbonPushButton *>() : nullptr;
+
+            if ((button) && (button->text()!=entry.group->groupName())) {
+                scheduleInvalidate();
+
+                continue;
+            }
+
+            if (entry.variant!=Expanded) {
+                continue;
+            }
+
+            auto width = qMax(entry.group->sizeHint().width(), entry.group->minimumSizeHint().width());
+
+            if (width!=entry.widths[Expanded]) {
+                scheduleInvalidate();
+            }
+        }
+    }
+
+    return false;
+}
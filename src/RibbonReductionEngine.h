@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONREDUCTIONENGINE_H
+#define NEDRYSOFT_RIBBONREDUCTIONENGINE_H
+
+#include "RibbonSpec.h"
+
+#include <QBoxLayout>
+#include <QFrame>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+
+namespace Nedrysoft { namespace Ribbon {
+    class RibbonGroup;
+    class RibbonPushButton;
+
+    /**
+     * @brief       The width granularity used to memoise reduction solutions.
+     */
+    constexpr auto RibbonReductionWidthBucket = 16;
+
+    /**
+     * @brief       The RibbonReductionEngine collapses the groups of a ribbon page to fit the available width.
+     *
+     * @details     Each group on the page has a set of size variants, the group at its full size and the group
+     *              collapsed to a single drop down button which shows the group in a popup.  The widths of the
+     *              variants are measured once, then for a given width the groups are reduced one variant at a time
+     *              starting from the rightmost group until the page fits, which is linear in the number of variants.
+     *              Solutions are memoised by width bucket so that interactive resizing does not need to solve again.
+     *
+     *              The engine attaches itself to the widget whose layout contains the groups and is destroyed with
+     *              it, deleting the engine restores all groups to their full size.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonReductionEngine :
+            public QObject {
+
+        private:
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief       The size variants of a group, ordered from widest to narrowest.
+             */
+            enum Variant {
+                Expanded = 0,                                                   /**< The group at its full size. */
+                Collapsed = 1,                                                  /**< The group as a drop down button. */
+                VariantCount = 2
+            };
+
+            /**
+             * @brief       Constructs a new RibbonReductionEngine for the groups in the given page.
+             *
+             * @note        If the page does not contain any groups the engine is inert, isValid() can be used to
+             *              check.
+             *
+             * @param[in]   page the page containing the groups.
+             */
+            explicit RibbonReductionEngine(QWidget *page);
+
+            /**
+             * @brief       Destroys the RibbonReductionEngine, restoring all groups to their full size.
+             */
+            ~RibbonReductionEngine() override;
+
+            /**
+             * @brief       Returns whether the engine found a layout of groups to manage.
+             *
+             * @returns     true if the engine is managing groups; otherwise false.
+             */
+            auto isValid() -> bool;
+
+            /**
+             * @brief       Discards the measured variant widths and memoised solutions.
+             *
+             * @note        Should be called when groups are added or removed, or their contents changed.
+             */
+            auto invalidate() -> void;
+
+            /**
+             * @brief       Returns the variant of each group that best fits the available width.
+             *
+             * @param[in]   availableWidth the width available to the page.
+             *
+             * @returns     the variant of each group, in layout order.
+             */
+            auto solve(int availableWidth) -> QVector<int>;
+
+            /**
+             * @brief       Reduces the groups to fit the available width.
+             *
+             * @param[in]   availableWidth the width available to the page.
+             */
+            auto reduce(int availableWidth) -> void;
+
+        protected:
+            /**
+             * @brief       Reimplements: QObject::eventFilter(QObject *watched, QEvent *event).
+             *
+             * @note        Used to reduce the groups when the page is resized and to invalidate the measurements
+             *              when a group is added to the page or the size of a group changes.
+             *
+             * @param[in]   watched the object that caused the event.
+             * @param[in]   event the event information.
+             *
+             * @returns     true if the event was handled; otherwise false.
+             */
+            auto eventFilter(QObject *watched, QEvent *event) -> bool override;
+
+        private:
+            /**
+             * @brief       Finds the groups in the layout and measures the width of each variant.
+             */
+            auto measure() -> void;
+
+            /**
+             * @brief       Shows the given group at the given variant.
+             *
+             * @param[in]   index the index of the group.
+             * @param[in]   variant the variant to show.
+             */
+            auto setVariant(int index, int variant) -> void;
+
+            /**
+             * @brief       Creates the collapsed representation of a group.
+             *
+             * @param[in]   index the index of the group.
+             */
+            auto createCollapsedGroup(int index) -> void;
+
+            /**
+             * @brief       Updates the button of a collapsed group from the name and collapsed icon of the group.
+             *
+             * @param[in]   index the index of the group.
+             */
+            auto updateCollapsedGroup(int index) -> void;
+
+            /**
+             * @brief       Shows the full group in a popup below its collapsed button.
+             *
+             * @param[in]   index the index of the group.
+             */
+            auto showPopup(int index) -> void;
+
+            /**
+             * @brief       Invalidates the measurements on the next pass of the event loop.
+             *
+             * @note        Used when a group is added, as the group is only inserted into the layout after it has
+             *              been added to the page.
+             */
+            auto scheduleInvalidate() -> void;
+
+        private:
+            //! @cond
+
+            struct Group {
+                QPointer<Nedrysoft::Ribbon::RibbonGroup> group;
+                QPointer<Nedrysoft::Ribbon::RibbonGroup> collapsedGroup;
+                QPointer<QFrame> popup;
+                QVector<int> widths;
+                int variant;
+            };
+
+            QWidget *m_container;
+            QPointer<QBoxLayout> m_layout;
+            QVector<Group> m_groups;
+            QHash<int, QVector<int> > m_solutions;
+            int m_fixedWidth;
+            bool m_measured;
+            bool m_invalidateScheduled;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONREDUCTIONENGINE_H
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonSingleLineEdit.h"
+
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
+#include "RibbonWidget.h"
+
+#include <QKeyEvent>
+#include <ThemeSupport>
+
+constexpr auto ThemeStylesheet = R"(
+    QLineEdit {
+        [background-colour];
+        height: 13px;
+        [border];
+        padding: 0px;
+    }
+
+    QLineEdit:focus {
+        [border];
+    }
+)";
+
+constexpr auto WidgetHeight = 21;
+
+Nedrysoft::Ribbon::RibbonSingleLineEditValidator::RibbonSingleLineEditValidator(QObject *parent) :
+        QValidator(parent) {
+
+}
+
+auto Nedrysoft::Ribbon::RibbonSingleLineEditValidator::validate(QString &input, int &pos) const -> QValidator::State {
+    if ((input.contains('\r')) || (input.contains('\n'))) {
+        auto removed = input.left(pos).count('\r')+input.left(pos).count('\n');
+
+        fixup(input);
+
+        pos -= removed;
+    }
+
+    return QValidator::Acceptable;
+}
+
+auto Nedrysoft::Ribbon::RibbonSingleLineEditValidator::fixup(QString &input) const -> void {
+    input.remove('\r');
+    input.remove('\n');
+}
+
+Nedrysoft::Ribbon::RibbonSingleLineEdit::RibbonSingleLineEdit(QWidget *parent) :
+        QLineEdit(parent) {
+
+    setAttribute(Qt::WA_MacShowFocusRect,false);
+
+    setValidator(new RibbonSingleLineEditValidator(this));
+
+    auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
+        updateStyleSheet(isDarkMode);
+    });
+
+    updateStyleSheet(themeSupport->isDarkMode());
+
+    QLineEdit::setMinimumHeight(WidgetHeight);
+    QLineEdit::setMaximumHeight(WidgetHeight);
+
+    QLineEdit::setSizePolicy(sizePolicy().horizontalPolicy(), QSizePolicy::Fixed);
+
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 12,0))
+    QPalette palette = QLineEdit::palette();
+
+    if (themeSupport->isDarkMode()) {
+        palette.setColor(QPalette::PlaceholderText, QColor(Qt::darkGray).lighter(125));
+    } else {
+        palette.setColor(QPalette::PlaceholderText, Qt::darkGray);
+    }
+
+    setPalette(palette);
+#endif
+}
+
+Nedrysoft::Ribbon::RibbonSingleLineEdit::~RibbonSingleLineEdit() {
+}
+
+void Nedrysoft::Ribbon::RibbonSingleLineEdit::setText(const QString &text) {
+    auto plainString = text;
+
+    plainString.remove('\r');
+    plainString.remove('\n');
+
+    QLineEdit::setText(plainString);
+}
+
+void Nedrysoft::Ribbon::RibbonSingleLineEdit::setMinimumHeight(int minimumHeight) {
+    Q_UNUSED(minimumHeight)
+
+    QLineEdit::setMinimumHeight(WidgetHeight);
+}
+
+void Nedrysoft::Ribbon::RibbonSingleLineEdit::setMaximumHeight(int maximumHeight) {
+    Q_UNUSED(maximumHeight)
+
+    QLineEdit::setMaximumHeight(WidgetHeight);
+}
+
+void Nedrysoft::Ribbon::RibbonSingleLineEdit::setSizePolicy(QSizePolicy policy) {
+    QLineEdit::setSizePolicy(policy.horizontalPolicy(), QSizePolicy::Fixed);
+}
+
+void Nedrysoft::Ribbon::RibbonSingleLineEdit::setSizePolicy(
+        QSizePolicy::Policy horizontal,
+        QSizePolicy::Policy vertical) {
+
+    Q_UNUSED(vertical)
+
+    QLineEdit::setSizePolicy(horizontal, QSizePolicy::Fixed);
+}
+
+auto Nedrysoft::Ribbon::RibbonSingleLineEdit::event(QEvent *e) -> bool {
+    switch(e->type()) {
+        case QEvent::KeyPress:
+        case QEvent::KeyRelease: {
+            auto keyEvent = static_cast<QKeyEvent *>(e);
+
+            switch(keyEvent->key()) {
+                case Qt::Key_Enter:
+                case Qt::Key_Return: {
+                    e->accept();
+
+                    return true;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    return QLineEdit::event(e);
+}
+
+auto Nedrysoft::Ribbon::RibbonSingleLineEdit::updateStyleSheet(bool isDarkMode) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
+
+    if (RibbonStyle::isActive()) {
+        // the palette is derived from the theme when the widget is polished.
+
+        style()->polish(this);
+
+        update();
+
+        return;
+    }
+
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
+
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        styleSheet.replace("[border]", "border: 0px none");
+
+        if (isDarkMode) {
+            styleSheet.replace("[background-colour]", "background-color: #434343");
+        } else {
+            styleSheet.replace("[background-colour]", "background-color: #ffffff");
+        }
+
+        return styleSheet;
+    });
+
+    setStyleSheet(styleSheet);
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONSINGLELINEEDIT_H
+#define NEDRYSOFT_RIBBONSINGLELINEEDIT_H
+
+#include "RibbonSpec.h"
+
+#include <QLineEdit>
+#include <QValidator>
+
+namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The RibbonSingleLineEditValidator removes carriage returns and line feeds from input.
+     *
+     * @details     Used by RibbonSingleLineEdit to sanitise pasted text, the input is always accepted once
+     *              the line breaks have been removed.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonSingleLineEditValidator :
+            public QValidator {
+
+        private:
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief       Constructs a new RibbonSingleLineEditValidator instance which is a child of the parent.
+             *
+             * @param[in]   parent the owner object.
+             */
+            explicit RibbonSingleLineEditValidator(QObject *parent=nullptr);
+
+            /**
+             * @brief       Reimplements: QValidator::validate(QString &input, int &pos).
+             *
+             * @param[in,out]   input the text to validate, line breaks are removed.
+             * @param[in,out]   pos the cursor position, adjusted for any removed characters.
+             *
+             * @returns     QValidator::Acceptable.
+             */
+            auto validate(QString &input, int &pos) const -> QValidator::State override;
+
+            /**
+             * @brief       Reimplements: QValidator::fixup(QString &input).
+             *
+             * @param[in,out]   input the text to fix, line breaks are removed.
+             */
+            auto fixup(QString &input) const -> void override;
+    };
+
+    /**
+     * @brief       The RibbonSingleLineEdit widget provides a lightweight ribbon stylised line edit.
+     *
+     * @details     Provides the same behaviour as RibbonLineEdit (placeholder text, pasted text is sanitised and the
+     *              enter and return keys are discarded) but is built on QLineEdit rather than a rich text document,
+     *              so it uses considerably less memory and does not re-layout the text on every key press.
+     *
+     * @note        Setting a different validator replaces the line break sanitising.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonSingleLineEdit :
+            public QLineEdit {
+
+        private:
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief       Constructs a new RibbonSingleLineEdit instance which is a child of the parent.
+             *
+             * @param[in]   parent the owner widget.
+             */
+            explicit RibbonSingleLineEdit(QWidget *parent=nullptr);
+
+            /**
+             * @brief       Destroys the RibbonSingleLineEdit.
+             */
+            ~RibbonSingleLineEdit() override;
+
+            /**
+             * @brief       Sets the text of the line edit, carriage returns and line feeds are removed.
+             *
+             * @note        This hides the superclasses implementation so that text set programmatically
+             *              is sanitised in the same way as pasted text.
+             *
+             * @param[in]   text the text.
+             */
+            void setText(const QString &text);
+
+            /**
+             * @brief       Reimplements QWidget::setMinimumHeight(int minimumHeight)
+             *
+             * @note        This hides the superclasses implementation as the ribbon line edit has a fixed height and
+             *              we ignore any attempts to set it.
+             *
+             * @param[in]   minimumHeight the minimum height for the widget.
+             */
+            void setMinimumHeight(int minimumHeight);
+
+            /**
+             * @brief       Reimplements QWidget::setMaximumHeight(int maximumHeight)
+             *
+             * @note        This hides the superclasses implementation as the ribbon line edit has a fixed height and
+             *              we ignore any attempts to set it.
+             *
+             * @param[in]   maximumHeight the maximum height for the widget.
+             */
+            void setMaximumHeight(int maximumHeight);
+
+            /**
+             * @brief       Reimplements QWidget::setSizePolicy(QSizePolicy::Policy horizontal,
+             *              QSizePolicy::Policy vertical)
+             *
+             * @note        This hides the superclasses implemention as the ribbon line edit has a fixed height and
+             *              we ignore any attempts to set it.
+             *
+             * @param[in]   horizontal the horizontal size policy.
+             * @param[in]   vertical the vertical size policy.
+             */
+            void setSizePolicy(QSizePolicy::Policy horizontal, QSizePolicy::Policy vertical);
+
+            /**
+             * @brief       Reimplements QWidget::setSizePolicy(QSizePolicy policy)
+             *
+             * @note        This hides the superclasses implemention as the ribbon line edit has a fixed height and
+             *              we ignore any attempts to set it.
+             *
+             * @param[in]   policy the size policy.
+             */
+            void setSizePolicy(QSizePolicy policy);
+
+        protected:
+            /**
+             * @brief       Reimplements QLineEdit::event(QEvent *event).
+             *
+             * @note        Used to discard enter + return keys.
+             *
+             * @param[in]   event the event information.
+             *
+             * @returns     true if event handled; otherwise false.
+             */
+            auto event(QEvent *event) -> bool override;
+
+        private:
+            /**
+             * @brief       Updates the stylesheet when the operating system theme is changed.
+             *
+             * @param[in]   isDarkMode true if dark mode; otherwise false.
+             */
+            auto updateStyleSheet(bool isDarkMode) -> void;
+    };
+}}
+
+#endif //NEDRYSOFT_RIBBONSINGLELINEEDIT_H
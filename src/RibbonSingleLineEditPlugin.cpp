@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonSingleLineEditPlugin.h"
+#include "RibbonSingleLineEdit.h"
+
+#include <QtPlugin>
+
+constexpr auto ConfigurationXML = R"(
+    <ui language="c++" displayname="Ribbon Single Line Edit">
+        <widget class="Nedrysoft::Ribbon::RibbonSingleLineEdit" name="ribbonSingleLineEdit">
+            <property name="geometry">
+                <rect>
+                    <x>0</x>
+                    <y>0</y>
+                    <width>100</width>
+                    <height>13</height>
+                </rect>
+            </property>
+        </widget>
+    </ui>
+)";
+
+RibbonSingleLineEditPlugin::RibbonSingleLineEditPlugin(QObject *parent) :
+        QObject(parent),
+        m_initialized(false) {
+
+}
+
+void RibbonSingleLineEditPlugin::initialize(QDesignerFormEditorInterface *core) {
+    Q_UNUSED(core)
+
+    if (m_initialized) {
+        return;
+    }
+
+    m_initialized = true;
+}
+
+bool RibbonSingleLineEditPlugin::isInitialized() const {
+    return m_initialized;
+}
+
+QWidget *RibbonSingleLineEditPlugin::createWidget(QWidget *parent) {
+    return new Nedrysoft::Ribbon::RibbonSingleLineEdit(parent);
+}
+
+QString RibbonSingleLineEditPlugin::name() const {
+    return QStringLiteral("Nedrysoft::Ribbon::RibbonSingleLineEdit");
+}
+
+QString RibbonSingleLineEditPlugin::group() const {
+    return QStringLiteral("Nedrysoft Ribbon Widgets");
+}
+
+QIcon RibbonSingleLineEditPlugin::icon()  const {
+    return QIcon(":/Nedrysoft/Ribbon/icons/ribbon.png");
+}
+
+QString RibbonSingleLineEditPlugin::toolTip() const {
+    return tr("A Ribbon Single Line Edit");
+}
+
+QString RibbonSingleLineEditPlugin::whatsThis() const {
+    return tr("The Ribbon Single Line Edit is a lightweight QLineEdit subclass that is styled to match the Ribbon.");
+}
+
+bool RibbonSingleLineEditPlugin::isContainer() const {
+    return false;
+}
+
+QString RibbonSingleLineEditPlugin::domXml() const {
+    return ConfigurationXML;
+}
+
+QString RibbonSingleLineEditPlugin::includeFile() const {
+    return QStringLiteral("<RibbonSingleLineEdit>");
+}
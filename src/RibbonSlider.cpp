@@ -23,6 +23,11 @@
 
 #include "RibbonSlider.h"
 
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
+
 #include <QApplication>
 #include <QSpacerItem>
 
@@ -53,7 +58,9 @@ Nedrysoft::Ribbon::RibbonSlider::RibbonSlider(QWidget *parent) :
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheet(isDarkMode);
     });
 
@@ -64,15 +71,33 @@ Nedrysoft::Ribbon::RibbonSlider::~RibbonSlider() {
 }
 
 auto Nedrysoft::Ribbon::RibbonSlider::updateStyleSheet(bool isDarkMode) -> void {
-    QString styleSheet(ThemeStylesheet);
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
 
-    styleSheet.replace("[theme]", isDarkMode ? "dark" : "light");
+    if (RibbonStyle::isActive()) {
+        update();
 
-    if (isDarkMode) {
-        styleSheet.replace("[background-colour]", "#434343");
-    } else {
-        styleSheet.replace("[background-colour]", "#c8c9c8");
+        return;
     }
 
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
+
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        styleSheet.replace("[theme]", isDarkMode ? "dark" : "light");
+
+        if (isDarkMode) {
+            styleSheet.replace("[background-colour]", "#434343");
+        } else {
+            styleSheet.replace("[background-colour]", "#c8c9c8");
+        }
+
+        return styleSheet;
+    });
+
     setStyleSheet(styleSheet);
 }
@@ -0,0 +1,392 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonSplitButton.h"
+
+#include "RibbonFontManager.h"
+#include "RibbonIconTinter.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonThemeDispatcher.h"
+
+#include <QCursor>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPaintEvent>
+
+constexpr auto ButtonPadding = 3;
+constexpr auto TextSpacing = 4;
+constexpr auto ArrowWidth = 5;
+constexpr auto ArrowHeight = 5;
+
+static auto eventPosition(QMouseEvent *mouseEvent) -> QPoint {
+#if (QT_VERSION_MAJOR>=6)
+    return mouseEvent->position().toPoint();
+#else
+    return mouseEvent->pos();
+#endif
+}
+
+Nedrysoft::Ribbon::RibbonSplitButton::RibbonSplitButton(QWidget *parent) :
+        QWidget(parent),
+        m_iconSize(QSize(RibbonSplitButtonDefaultIconWidth, RibbonSplitButtonDefaultIconHeight)),
+        m_theme(Nedrysoft::Ribbon::Light),
+        m_action(nullptr),
+        m_hoverRegion(NoRegion),
+        m_pressedRegion(NoRegion),
+        m_vertical(true) {
+
+    auto fontManager = RibbonFontManager::getInstance();
+
+    m_font = fontManager->font(FontRole::Normal, RibbonSplitButtonDefaultFontSize);
+
+    setMouseTracking(true);
+
+    setSizePolicy(QSizePolicy::Minimum, QSizePolicy::Minimum);
+
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
+        updateTheme(isDarkMode);
+    });
+
+    auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+
+    updateTheme(themeSupport->isDarkMode());
+}
+
+Nedrysoft::Ribbon::RibbonSplitButton::~RibbonSplitButton() {
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::icon() -> QIcon {
+    return m_icon;
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::setIcon(const QIcon &icon) -> void {
+    m_icon = icon;
+
+    update(regionRect(MainRegion));
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::iconSize() -> QSize {
+    return m_iconSize;
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::setIconSize(QSize iconSize) -> void {
+    m_iconSize = iconSize;
+
+    updateGeometry();
+    update();
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::vertical() -> bool {
+    return m_vertical;
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::setVertical(bool vertical) -> void {
+    if (vertical==m_vertical) {
+        return;
+    }
+
+    m_vertical = vertical;
+
+    updateGeometry();
+    update();
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::text() -> QString {
+    return m_text;
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::setText(const QString &text) -> void {
+    m_text = text;
+
+    updateGeometry();
+    update();
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::setAction(Nedrysoft::Ribbon::RibbonAction *action) -> void {
+    if (m_action) {
+        m_action->removeWidget(this);
+    }
+
+    m_action = action;
+
+    if (m_action) {
+        m_action->addWidget(this);
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::mainSize() const -> QSize {
+    auto size = m_iconSize;
+
+    if (!m_text.isEmpty()) {
+        auto fontManager = RibbonFontManager::getInstance();
+
+        auto fontMetrics = fontManager->fontMetrics(FontRole::Normal, RibbonSplitButtonDefaultFontSize);
+
+        size.rwidth() += TextSpacing+fontMetrics.boundingRect(m_text).width();
+        size.setHeight(qMax(size.height(), fontMetrics.height()));
+    }
+
+    return size+QSize(ButtonPadding*2, ButtonPadding*2);
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::sizeHint() const -> QSize {
+    auto size = mainSize();
+
+    if (m_vertical) {
+        return QSize(
+                qMax(size.width(), RibbonSplitButtonHorizontalDropWidth),
+                size.height()+RibbonSplitButtonVerticalDropHeight);
+    }
+
+    return QSize(
+            size.width()+RibbonSplitButtonHorizontalDropWidth,
+            qMax(size.height(), RibbonSplitButtonHorizontalDropHeight));
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::minimumSizeHint() const -> QSize {
+    return sizeHint();
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::updateTheme(bool isDarkMode) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
+
+    m_theme = isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light;
+
+    update();
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::regionRect(Region region) const -> QRect {
+    // the regions match the geometry of the two buttons in a RibbonDropButton.
+
+    if (m_vertical) {
+        auto mainHeight = qBound(0, mainSize().height(), height()-RibbonSplitButtonVerticalDropHeight);
+
+        switch(region) {
+            case MainRegion: {
+                return QRect(0, 0, width(), mainHeight);
+            }
+
+            case DropRegion: {
+                return QRect(0, mainHeight, width(), RibbonSplitButtonVerticalDropHeight);
+            }
+
+            default: {
+                return QRect();
+            }
+        }
+    }
+
+    auto dropWidth = qMin(RibbonSplitButtonHorizontalDropWidth, width());
+
+    switch(region) {
+        case MainRegion: {
+            return QRect(0, 0, width()-dropWidth, height());
+        }
+
+        case DropRegion: {
+            return QRect(
+                    width()-dropWidth,
+                    (height()-RibbonSplitButtonHorizontalDropHeight)/2,
+                    dropWidth,
+                    RibbonSplitButtonHorizontalDropHeight);
+        }
+
+        default: {
+            return QRect();
+        }
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::regionAt(const QPoint &position) const -> Region {
+    if (regionRect(MainRegion).contains(position)) {
+        return MainRegion;
+    }
+
+    if (regionRect(DropRegion).contains(position)) {
+        return DropRegion;
+    }
+
+    return NoRegion;
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::regionColor(Region region) const -> QColor {
+    if (region==m_hoverRegion) {
+        if (region==m_pressedRegion) {
+            return QColor(Nedrysoft::Ribbon::ControlPressedColor[m_theme]);
+        }
+
+        return QColor(Nedrysoft::Ribbon::ControlHoverColor[m_theme]);
+    }
+
+    return QColor(Nedrysoft::Ribbon::ControlBackgroundColor[m_theme]);
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::updateHover(const QPoint &position) -> void {
+    auto region = regionAt(position);
+
+    if (region!=m_hoverRegion) {
+        update(regionRect(m_hoverRegion));
+        update(regionRect(region));
+
+        m_hoverRegion = region;
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::event(QEvent *event) -> bool {
+    switch(event->type()) {
+        case QEvent::Enter: {
+            updateHover(mapFromGlobal(QCursor::pos()));
+
+            break;
+        }
+
+        case QEvent::Leave: {
+            updateHover(QPoint(-1, -1));
+
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    return QWidget::event(event);
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::mousePressEvent(QMouseEvent *event) -> void {
+    auto region = regionAt(eventPosition(event));
+
+    if ((event->button()!=Qt::LeftButton) || (region==NoRegion)) {
+        QWidget::mousePressEvent(event);
+
+        return;
+    }
+
+    m_pressedRegion = region;
+
+    update(regionRect(region));
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::mouseMoveEvent(QMouseEvent *event) -> void {
+    // while a region is held down, the pressed state follows the mouse in and out of the region.
+
+    updateHover(eventPosition(event));
+
+    QWidget::mouseMoveEvent(event);
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::mouseReleaseEvent(QMouseEvent *event) -> void {
+    if ((event->button()!=Qt::LeftButton) || (m_pressedRegion==NoRegion)) {
+        QWidget::mouseReleaseEvent(event);
+
+        return;
+    }
+
+    auto region = m_pressedRegion;
+
+    m_pressedRegion = NoRegion;
+
+    update(regionRect(region));
+
+    if (regionAt(eventPosition(event))!=region) {
+        return;
+    }
+
+    auto dropDown = (region==DropRegion);
+
+    if (m_action) {
+        auto dropButtonEvent = Nedrysoft::Ribbon::DropButtonClickedEvent(this, dropDown);
+
+        m_action->triggerEvent(&dropButtonEvent);
+    }
+
+    Q_EMIT clicked(dropDown);
+}
+
+auto Nedrysoft::Ribbon::RibbonSplitButton::paintEvent(QPaintEvent *event) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(Paint);
+
+    QPainter painter(this);
+
+    auto mainRect = regionRect(MainRegion);
+    auto dropRect = regionRect(DropRegion);
+
+    // a hover or press change only repaints the affected region, so the other region is skipped unless it is dirty.
+
+    if (event->rect().intersects(mainRect)) {
+        painter.fillRect(mainRect, regionColor(MainRegion));
+
+        auto contentSize = mainSize()-QSize(ButtonPadding*2, ButtonPadding*2);
+        auto contentRect = QRect(QPoint(0, 0), contentSize);
+
+        contentRect.moveCenter(mainRect.center());
+
+        if (!m_icon.isNull()) {
+            auto iconRect = QRect(contentRect.left(), 0, m_iconSize.width(), m_iconSize.height());
+
+            iconRect.moveTop(mainRect.center().y()-(m_iconSize.height()/2));
+
+            m_icon.paint(&painter, iconRect, Qt::AlignCenter, isEnabled() ? QIcon::Normal : QIcon::Disabled);
+        }
+
+        if (!m_text.isEmpty()) {
+            auto textRect = QRect(
+                    contentRect.left()+m_iconSize.width()+TextSpacing,
+                    mainRect.top(),
+                    contentRect.right()-(contentRect.left()+m_iconSize.width()+TextSpacing)+1,
+                    mainRect.height());
+
+            painter.setFont(m_font);
+
+            painter.setPen(
+                    palette().color(isEnabled() ? QPalette::Active : QPalette::Disabled, QPalette::WindowText));
+
+            painter.drawText(textRect, Qt::AlignLeft | Qt::AlignVCenter, m_text);
+        }
+    }
+
+    if (event->rect().intersects(dropRect)) {
+        painter.fillRect(dropRect, regionColor(DropRegion));
+
+        auto arrowPixmap = RibbonIconTinter::getInstance()->pixmap(
+                "arrow-drop",
+                Nedrysoft::Ribbon::GlyphColor[m_theme],
+                devicePixelRatioF());
+
+        // the arrow glyph is not square, it is fitted inside the arrow size so that it is not distorted.
+
+        auto arrowSize = (arrowPixmap.size()/arrowPixmap.devicePixelRatio()).scaled(
+                ArrowWidth,
+                ArrowHeight,
+                Qt::KeepAspectRatio);
+
+        auto arrowRect = QRect(QPoint(0, 0), arrowSize);
+
+        arrowRect.moveCenter(dropRect.center());
+
+        painter.drawPixmap(arrowRect, arrowPixmap);
+    }
+}
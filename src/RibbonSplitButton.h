@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONSPLITBUTTON_H
+#define NEDRYSOFT_RIBBONSPLITBUTTON_H
+
+#include "RibbonAction.h"
+#include "RibbonSpec.h"
+#include "RibbonWidget.h"
+
+#include <QFont>
+#include <QIcon>
+#include <QPointer>
+#include <QWidget>
+
+namespace Nedrysoft { namespace Ribbon {
+    constexpr auto RibbonSplitButtonDefaultIconWidth = 32;
+    constexpr auto RibbonSplitButtonDefaultIconHeight = 48;
+    constexpr auto RibbonSplitButtonDefaultFontSize = 10;
+    constexpr auto RibbonSplitButtonVerticalDropHeight = 16;
+    constexpr auto RibbonSplitButtonHorizontalDropHeight = 20;
+    constexpr auto RibbonSplitButtonHorizontalDropWidth = 16;
+
+    /**
+     * @brief       The RibbonSplitButton widget provides a self painted alternative to RibbonDropButton.
+     *
+     * @details     A single widget that paints the main button and the drop down arrow itself and determines which
+     *              of the two was clicked from the position of the mouse, it has no child widgets and does not use a
+     *              stylesheet.  Like the RibbonDropButton it emits clicked(bool) and triggers a
+     *              DropButtonClickedEvent on its action.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonSplitButton :
+            public QWidget {
+
+        private:
+            Q_OBJECT
+
+            //! @cond
+
+            Q_PROPERTY(QIcon icon READ icon WRITE setIcon)
+            Q_PROPERTY(QSize iconSize READ iconSize WRITE setIconSize)
+            Q_PROPERTY(bool vertical READ vertical WRITE setVertical)
+            Q_PROPERTY(QString text READ text WRITE setText)
+
+            //! @endcond
+
+        public:
+            /**
+             * @brief       Constructs a new RibbonSplitButton which is a child of the parent.
+             *
+             * @param[in]   parent the owner widget.
+             */
+            explicit RibbonSplitButton(QWidget *parent=nullptr);
+
+            /**
+             * @brief       Destroys the RibbonSplitButton.
+             */
+            ~RibbonSplitButton() override;
+
+            /**
+             * @brief       Returns the icon that is currently assigned to the main button.
+             *
+             * @returns     the icon assigned to the main button.
+             */
+            auto icon() -> QIcon;
+
+            /**
+             * @brief       Sets the icon to be displayed on the main button.
+             *
+             * @param[in]   icon the icon to be displayed on the main button.
+             */
+            auto setIcon(const QIcon &icon) -> void;
+
+            /**
+             * @brief       Returns the current size of the icon.
+             *
+             * @returns     the current size of the icon.
+             */
+            auto iconSize() -> QSize;
+
+            /**
+             * @brief       Sets the current size of the icon.
+             *
+             * @param[in]   iconSize the new size of the icon to be used.
+             */
+            auto setIconSize(QSize iconSize) -> void;
+
+            /**
+             * @brief       Returns whether the drop down arrow is below the main button.
+             *
+             * @returns     true if vertical; otherwise false.
+             */
+            auto vertical() -> bool;
+
+            /**
+             * @brief       Sets whether the drop down arrow is below (vertical) or beside the main button.
+             *
+             * @param[in]   vertical true if vertical; otherwise false.
+             */
+            auto setVertical(bool vertical) -> void;
+
+            /**
+             * @brief       Returns the text that is displayed on the main button.
+             *
+             * @returns     the text displayed on the main button.
+             */
+            auto text() -> QString;
+
+            /**
+             * @brief       Sets the text to be displayed on the main button.
+             *
+             * @param[in]   text the text to be displayed on the main button.
+             */
+            auto setText(const QString &text) -> void;
+
+            /**
+             * @brief       Sets the ribbon action for this widget.
+             *
+             * @note        In addition to emitting the clicked signal, this widget will also trigger this
+             *              action.
+             *
+             * @param[in]   action the action to associate with this button.
+             */
+            auto setAction(Nedrysoft::Ribbon::RibbonAction *action) -> void;
+
+            /**
+             * @brief       Reimplements: QWidget::sizeHint().
+             *
+             * @returns     the recommended size of the widget.
+             */
+            auto sizeHint() const -> QSize override;
+
+            /**
+             * @brief       Reimplements: QWidget::minimumSizeHint().
+             *
+             * @returns     the minimum size of the widget.
+             */
+            auto minimumSizeHint() const -> QSize override;
+
+        private:
+            /**
+             * @brief       The regions of the button that respond to the mouse.
+             */
+            enum Region {
+                NoRegion = 0,
+                MainRegion = 1,
+                DropRegion = 2
+            };
+
+            /**
+             * @brief       Updates the theme used to paint the button when the operating system theme is changed.
+             *
+             * @param[in]   isDarkMode true if dark mode; otherwise false.
+             */
+            auto updateTheme(bool isDarkMode) -> void;
+
+            /**
+             * @brief       Returns the size required by the icon and text of the main button.
+             *
+             * @returns     the size of the main button.
+             */
+            auto mainSize() const -> QSize;
+
+            /**
+             * @brief       Returns the rectangle of the given region in widget coordinates.
+             *
+             * @param[in]   region the region.
+             *
+             * @returns     the rectangle of the region.
+             */
+            auto regionRect(Region region) const -> QRect;
+
+            /**
+             * @brief       Returns the region at the given position.
+             *
+             * @param[in]   position the position in widget coordinates.
+             *
+             * @returns     the region; or NoRegion if the position is not over the button.
+             */
+            auto regionAt(const QPoint &position) const -> Region;
+
+            /**
+             * @brief       Returns the background colour of the region in its current state.
+             *
+             * @param[in]   region the region.
+             *
+             * @returns     the background colour.
+             */
+            auto regionColor(Region region) const -> QColor;
+
+            /**
+             * @brief       Updates the hovered region from the given mouse position and repaints if it has changed.
+             *
+             * @param[in]   position the mouse position in widget coordinates.
+             */
+            auto updateHover(const QPoint &position) -> void;
+
+        public:
+            /**
+             * @brief       This signal is emitted when the either the main or drop-down region has been clicked.
+             *
+             * @param[in]   dropdown true if the drop-down region was clicked; otherwise false.
+             */
+            Q_SIGNAL void clicked(bool dropdown);
+
+        protected:
+            /**
+             * @brief       Reimplements: QWidget::event(QEvent *event).
+             *
+             * @note        Used to track the mouse entering and leaving the widget.
+             *
+             * @param[in]   event the event information.
+             *
+             * @returns     true if event handled; otherwise false.
+             */
+            auto event(QEvent *event) -> bool override;
+
+            /**
+             * @brief       Reimplements: QWidget::paintEvent(QPaintEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto paintEvent(QPaintEvent *event) -> void override;
+
+            /**
+             * @brief       Reimplements: QWidget::mousePressEvent(QMouseEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto mousePressEvent(QMouseEvent *event) -> void override;
+
+            /**
+             * @brief       Reimplements: QWidget::mouseMoveEvent(QMouseEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto mouseMoveEvent(QMouseEvent *event) -> void override;
+
+            /**
+             * @brief       Reimplements: QWidget::mouseReleaseEvent(QMouseEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto mouseReleaseEvent(QMouseEvent *event) -> void override;
+
+        private:
+            //! @cond
+
+            QIcon m_icon;
+            QSize m_iconSize;
+            QString m_text;
+            QFont m_font;
+            Nedrysoft::Ribbon::ThemeMode m_theme;
+            QPointer<Nedrysoft::Ribbon::RibbonAction> m_action;
+            Region m_hoverRegion;
+            Region m_pressedRegion;
+            bool m_vertical;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONSPLITBUTTON_H
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonSplitButtonPlugin.h"
+
+#include "RibbonSplitButton.h"
+
+#include <QRegularExpression>
+#include <QtPlugin>
+
+constexpr auto ConfigurationXML = R"(
+    <ui language="c++" displayname="Ribbon Split Button">
+        <widget class="Nedrysoft::Ribbon::RibbonSplitButton" name="ribbonSplitButton">
+            <property name="text">
+                <string>Button</string>
+            </property>
+        </widget>
+    </ui>
+)";
+
+RibbonSplitButtonPlugin::RibbonSplitButtonPlugin(QObject *parent) :
+        QObject(parent),
+        m_initialized(false) {
+
+}
+
+void RibbonSplitButtonPlugin::initialize(QDesignerFormEditorInterface *core) {
+    Q_UNUSED(core)
+
+    if (m_initialized) {
+        return;
+    }
+
+    m_initialized = true;
+}
+
+bool RibbonSplitButtonPlugin::isInitialized() const {
+    return m_initialized;
+}
+
+QWidget * RibbonSplitButtonPlugin::createWidget(QWidget *parent) {
+    return new Nedrysoft::Ribbon::RibbonSplitButton(parent);
+}
+
+QString RibbonSplitButtonPlugin::name() const {
+    return QStringLiteral("Nedrysoft::Ribbon::RibbonSplitButton");
+}
+
+QString RibbonSplitButtonPlugin::group() const {
+    return QStringLiteral("Nedrysoft Ribbon Widgets");
+}
+
+QIcon RibbonSplitButtonPlugin::icon() const {
+    return QIcon(":/Nedrysoft/Ribbon/icons/ribbon.png");
+}
+
+QString RibbonSplitButtonPlugin::toolTip() const {
+    return tr("A Ribbon Split Button");
+}
+
+QString RibbonSplitButtonPlugin::whatsThis() const {
+    return tr("The Ribbon Split Button is a self painted drop button with a main action and a drop down arrow for extended actions and is styled to match the Ribbon.");
+}
+
+bool RibbonSplitButtonPlugin::isContainer() const {
+    return false;
+}
+
+QString RibbonSplitButtonPlugin::domXml() const {
+    return ConfigurationXML;
+}
+
+QString RibbonSplitButtonPlugin::includeFile() const {
+    return QStringLiteral("<RibbonSplitButton>");
+}
@@ -0,0 +1,433 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonStyle.h"
+
+#include "RibbonButton.h"
+#include "RibbonCheckBox.h"
+#include "RibbonComboBox.h"
+#include "RibbonDropButton.h"
+#include "RibbonIconCache.h"
+#include "RibbonIconTinter.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonLineEdit.h"
+#include "RibbonSingleLineEdit.h"
+#include "RibbonSlider.h"
+#include "RibbonTabBar.h"
+#include "RibbonToolButton.h"
+#include "RibbonWidget.h"
+
+#include <QApplication>
+#include <QPalette>
+#include <QPainter>
+#include <QStyleOption>
+#include <ThemeSupport>
+
+constexpr auto CheckBoxIndicatorSize = 14;
+constexpr auto ComboBoxArrowWidth = 5;
+constexpr auto ComboBoxArrowHeight = 4;
+constexpr auto SliderGrooveHeight = 4;
+constexpr auto SliderHandleSize = 10;
+constexpr auto TabPadding = 18;
+
+static auto currentTheme() -> Nedrysoft::Ribbon::ThemeMode {
+    auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+
+    if (themeSupport->isDarkMode()) {
+        return Nedrysoft::Ribbon::Dark;
+    }
+
+    return Nedrysoft::Ribbon::Light;
+}
+
+static auto isButtonContainer(const QWidget *widget) -> bool {
+    if (!widget) {
+        return false;
+    }
+
+    return qobject_cast<const Nedrysoft::Ribbon::RibbonDropButton *>(widget->parentWidget());
+}
+
+static auto isRibbonControl(const QWidget *widget) -> bool {
+    if (!widget) {
+        return false;
+    }
+
+    return qobject_cast<const Nedrysoft::Ribbon::RibbonButton *>(widget) ||
+           qobject_cast<const Nedrysoft::Ribbon::RibbonCheckBox *>(widget) ||
+           qobject_cast<const Nedrysoft::Ribbon::RibbonComboBox *>(widget) ||
+           qobject_cast<const Nedrysoft::Ribbon::RibbonLineEdit *>(widget) ||
+           qobject_cast<const Nedrysoft::Ribbon::RibbonSingleLineEdit *>(widget) ||
+           qobject_cast<const Nedrysoft::Ribbon::RibbonSlider *>(widget) ||
+           qobject_cast<const Nedrysoft::Ribbon::RibbonToolButton *>(widget) ||
+           isButtonContainer(widget);
+}
+
+static auto buttonColor(const QStyleOption *option) -> QColor {
+    auto theme = currentTheme();
+
+    if (option->state & QStyle::State_Sunken) {
+        return Nedrysoft::Ribbon::ControlPressedColor[theme];
+    }
+
+    if (option->state & QStyle::State_MouseOver) {
+        return Nedrysoft::Ribbon::ControlHoverColor[theme];
+    }
+
+    return Nedrysoft::Ribbon::ControlBackgroundColor[theme];
+}
+
+static auto textPalette(const QPalette &palette) -> QPalette {
+    auto themedPalette = palette;
+    auto textColor = QColor(Nedrysoft::Ribbon::TextColor[currentTheme()]);
+
+    // the disabled colours are left alone so that disabled controls are still drawn greyed out.
+
+    for (auto colorGroup : {QPalette::Active, QPalette::Inactive}) {
+        for (auto colorRole : {QPalette::WindowText, QPalette::ButtonText, QPalette::Text}) {
+            themedPalette.setColor(colorGroup, colorRole, textColor);
+        }
+    }
+
+    return themedPalette;
+}
+
+Nedrysoft::Ribbon::RibbonStyle::RibbonStyle(QStyle *style) :
+        QProxyStyle(style) {
+
+}
+
+auto Nedrysoft::Ribbon::RibbonStyle::isActive() -> bool {
+    return qobject_cast<RibbonStyle *>(QApplication::style())!=nullptr;
+}
+
+auto Nedrysoft::Ribbon::RibbonStyle::drawPrimitive(
+        QStyle::PrimitiveElement element,
+        const QStyleOption *option,
+        QPainter *painter,
+        const QWidget *widget) const -> void {
+
+    switch(element) {
+        case PE_IndicatorCheckBox: {
+            if (!qobject_cast<const RibbonCheckBox *>(widget)) {
+                break;
+            }
+
+            QString name = (option->state & State_On) ? "checked" : "unchecked";
+
+            if (option->state & State_MouseOver) {
+                name += "-hover";
+            }
+
+            auto indicatorRect = QRect(0, 0, CheckBoxIndicatorSize, CheckBoxIndicatorSize);
+
+            indicatorRect.moveCenter(option->rect.center());
+
+            painter->drawPixmap(
+                    indicatorRect,
+                    RibbonIconCache::getInstance()->pixmap(
+                            QString(":/Nedrysoft/Ribbon/icons/%1-[theme].png").arg(name),
+                            currentTheme(),
+                            indicatorRect.size(),
+                            painter->device()->devicePixelRatioF()));
+
+            return;
+        }
+
+        case PE_FrameFocusRect: {
+            if (isRibbonControl(widget)) {
+                return;
+            }
+
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    QProxyStyle::drawPrimitive(element, option, painter, widget);
+}
+
+auto Nedrysoft::Ribbon::RibbonStyle::drawControl(
+        QStyle::ControlElement element,
+        const QStyleOption *option,
+        QPainter *painter,
+        const QWidget *widget) const -> void {
+
+    NEDRYSOFT_RIBBON_MEASURE_CLASS(widget ? widget->metaObject()->className() : "QStyle", Paint);
+
+    switch(element) {
+        case CE_PushButtonBevel: {
+            if (!qobject_cast<const RibbonButton *>(widget) && !isButtonContainer(widget)) {
+                break;
+            }
+
+            painter->fillRect(option->rect, buttonColor(option));
+
+            return;
+        }
+
+        case CE_PushButtonLabel:
+        case CE_CheckBoxLabel: {
+            auto button = qstyleoption_cast<const QStyleOptionButton *>(option);
+
+            if ((!button) || (!isRibbonControl(widget))) {
+                break;
+            }
+
+            QStyleOptionButton labelOption = *button;
+
+            labelOption.palette = textPalette(button->palette);
+
+            QProxyStyle::drawControl(element, &labelOption, painter, widget);
+
+            return;
+        }
+
+        case CE_ComboBoxLabel: {
+            auto comboBox = qstyleoption_cast<const QStyleOptionComboBox *>(option);
+
+            if ((!comboBox) || (!qobject_cast<const RibbonComboBox *>(widget))) {
+                break;
+            }
+
+            QStyleOptionComboBox labelOption = *comboBox;
+
+            labelOption.palette = textPalette(comboBox->palette);
+
+            QProxyStyle::drawControl(element, &labelOption, painter, widget);
+
+            return;
+        }
+
+        case CE_ToolButtonLabel: {
+            auto toolButton = qstyleoption_cast<const QStyleOptionToolButton *>(option);
+
+            if ((!toolButton) || (!qobject_cast<const RibbonToolButton *>(widget))) {
+                break;
+            }
+
+            QStyleOptionToolButton labelOption = *toolButton;
+
+            labelOption.palette = textPalette(toolButton->palette);
+
+            QProxyStyle::drawControl(element, &labelOption, painter, widget);
+
+            return;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    QProxyStyle::drawControl(element, option, painter, widget);
+}
+
+auto Nedrysoft::Ribbon::RibbonStyle::drawComplexControl(
+        QStyle::ComplexControl control,
+        const QStyleOptionComplex *option,
+        QPainter *painter,
+        const QWidget *widget) const -> void {
+
+    NEDRYSOFT_RIBBON_MEASURE_CLASS(widget ? widget->metaObject()->className() : "QStyle", Paint);
+
+    switch(control) {
+        case CC_ToolButton: {
+            auto toolButton = qstyleoption_cast<const QStyleOptionToolButton *>(option);
+
+            if ((!toolButton) || (!qobject_cast<const RibbonToolButton *>(widget))) {
+                break;
+            }
+
+            painter->fillRect(toolButton->rect, buttonColor(toolButton));
+
+            QStyleOptionToolButton labelOption = *toolButton;
+
+            labelOption.rect = proxy()->subControlRect(control, toolButton, SC_ToolButton, widget);
+
+            proxy()->drawControl(CE_ToolButtonLabel, &labelOption, painter, widget);
+
+            return;
+        }
+
+        case CC_ComboBox: {
+            auto comboBox = qstyleoption_cast<const QStyleOptionComboBox *>(option);
+
+            if ((!comboBox) || (!qobject_cast<const RibbonComboBox *>(widget))) {
+                break;
+            }
+
+            auto theme = currentTheme();
+            auto arrowRect = proxy()->subControlRect(control, comboBox, SC_ComboBoxArrow, widget);
+
+            painter->fillRect(comboBox->rect, ControlBackgroundColor[theme]);
+
+            if ((comboBox->state & State_MouseOver) && (comboBox->activeSubControls & SC_ComboBoxArrow)) {
+                painter->fillRect(arrowRect, ControlHoverColor[theme]);
+            }
+
+            auto pixmapRect = QRect(0, 0, ComboBoxArrowWidth, ComboBoxArrowHeight);
+
+            pixmapRect.moveCenter(arrowRect.center());
+
+            painter->drawPixmap(
+                    pixmapRect,
+                    RibbonIconTinter::getInstance()->pixmap(
+                            "arrow-drop",
+                            GlyphColor[theme],
+                            painter->device()->devicePixelRatioF()));
+
+            return;
+        }
+
+        case CC_Slider: {
+            auto slider = qstyleoption_cast<const QStyleOptionSlider *>(option);
+
+            if ((!slider) || (slider->orientation!=Qt::Horizontal) || (!qobject_cast<const RibbonSlider *>(widget))) {
+                break;
+            }
+
+            auto theme = currentTheme();
+            auto grooveRect = proxy()->subControlRect(control, slider, SC_SliderGroove, widget);
+            auto handleRect = proxy()->subControlRect(control, slider, SC_SliderHandle, widget);
+
+            painter->fillRect(
+                    QRect(grooveRect.left(),
+                          grooveRect.center().y()-(SliderGrooveHeight/2),
+                          grooveRect.width(),
+                          SliderGrooveHeight),
+                    SliderGrooveColor[theme]);
+
+            auto pixmapRect = QRect(0, 0, SliderHandleSize, SliderHandleSize);
+
+            pixmapRect.moveCenter(handleRect.center());
+
+            painter->drawPixmap(
+                    pixmapRect,
+                    RibbonIconTinter::getInstance()->pixmap(
+                            "slider",
+                            GlyphColor[theme],
+                            painter->device()->devicePixelRatioF()));
+
+            return;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    QProxyStyle::drawComplexControl(control, option, painter, widget);
+}
+
+auto Nedrysoft::Ribbon::RibbonStyle::pixelMetric(
+        QStyle::PixelMetric metric,
+        const QStyleOption *option,
+        const QWidget *widget) const -> int {
+
+    switch(metric) {
+        case PM_IndicatorWidth:
+        case PM_IndicatorHeight: {
+            if (qobject_cast<const RibbonCheckBox *>(widget)) {
+                return CheckBoxIndicatorSize;
+            }
+
+            break;
+        }
+
+        case PM_SliderLength:
+        case PM_SliderThickness:
+        case PM_SliderControlThickness: {
+            if (qobject_cast<const RibbonSlider *>(widget)) {
+                return SliderHandleSize;
+            }
+
+            break;
+        }
+
+        case PM_DefaultFrameWidth:
+        case PM_ButtonMargin: {
+            if (isRibbonControl(widget)) {
+                return 0;
+            }
+
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+
+    return QProxyStyle::pixelMetric(metric, option, widget);
+}
+
+auto Nedrysoft::Ribbon::RibbonStyle::sizeFromContents(
+        QStyle::ContentsType type,
+        const QStyleOption *option,
+        const QSize &contentsSize,
+        const QWidget *widget) const -> QSize {
+
+    if ((type==CT_TabBarTab) && (qobject_cast<const RibbonTabBar *>(widget))) {
+        return contentsSize+QSize(TabPadding*2, 0);
+    }
+
+    return QProxyStyle::sizeFromContents(type, option, contentsSize, widget);
+}
+
+auto Nedrysoft::Ribbon::RibbonStyle::polish(QWidget *widget) -> void {
+    NEDRYSOFT_RIBBON_MEASURE_CLASS(widget->metaObject()->className(), Polish);
+
+    QProxyStyle::polish(widget);
+
+    if (!isRibbonControl(widget)) {
+        return;
+    }
+
+    widget->setAttribute(Qt::WA_Hover);
+
+    auto lineEdit = qobject_cast<RibbonLineEdit *>(widget);
+
+    if (lineEdit) {
+        auto palette = lineEdit->palette();
+
+        palette.setColor(QPalette::Base, ControlBackgroundColor[currentTheme()]);
+
+        lineEdit->setPalette(palette);
+        lineEdit->setFrameShape(QFrame::NoFrame);
+    }
+
+    auto singleLineEdit = qobject_cast<RibbonSingleLineEdit *>(widget);
+
+    if (singleLineEdit) {
+        auto palette = singleLineEdit->palette();
+
+        palette.setColor(QPalette::Base, ControlBackgroundColor[currentTheme()]);
+
+        singleLineEdit->setPalette(palette);
+        singleLineEdit->setFrame(false);
+    }
+}
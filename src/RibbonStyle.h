@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONSTYLE_H
+#define NEDRYSOFT_RIBBONSTYLE_H
+
+#include "RibbonSpec.h"
+
+#include <QProxyStyle>
+
+namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The RibbonStyle class provides a style that draws the ribbon controls directly.
+     *
+     * @details     By default each ribbon control is styled using a Qt stylesheet, which causes the stylesheet
+     *              style to be used for the whole widget subtree.  When a RibbonStyle is installed as the application
+     *              style the ribbon controls do not set any stylesheets, instead this style draws them using the
+     *              colour tables in RibbonWidget.h; all other widgets are drawn by the base style.
+     *
+     * @note        The style must be installed with QApplication::setStyle before any ribbon controls are created.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonStyle :
+            public QProxyStyle {
+
+        private:
+            Q_OBJECT
+
+        public:
+            /**
+             * @brief       Constructs a new RibbonStyle which draws non ribbon widgets with the given base style.
+             *
+             * @param[in]   style the base style, if nullptr then the default application style is used.
+             */
+            explicit RibbonStyle(QStyle *style = nullptr);
+
+            /**
+             * @brief       Returns whether a RibbonStyle is installed as the application style.
+             *
+             * @returns     true if the ribbon style is in use; otherwise false.
+             */
+            static auto isActive() -> bool;
+
+            /**
+             * @brief       Reimplements: QProxyStyle::drawPrimitive(...).
+             *
+             * @param[in]   element the primitive element to draw.
+             * @param[in]   option the style options.
+             * @param[in]   painter the painter to draw with.
+             * @param[in]   widget the widget being drawn.
+             */
+            auto drawPrimitive(
+                    QStyle::PrimitiveElement element,
+                    const QStyleOption *option,
+                    QPainter *painter,
+                    const QWidget *widget = nullptr) const -> void override;
+
+            /**
+             * @brief       Reimplements: QProxyStyle::drawControl(...).
+             *
+             * @param[in]   element the control element to draw.
+             * @param[in]   option the style options.
+             * @param[in]   painter the painter to draw with.
+             * @param[in]   widget the widget being drawn.
+             */
+            auto drawControl(
+                    QStyle::ControlElement element,
+                    const QStyleOption *option,
+                    QPainter *painter,
+                    const QWidget *widget = nullptr) const -> void override;
+
+            /**
+             * @brief       Reimplements: QProxyStyle::drawComplexControl(...).
+             *
+             * @param[in]   control the complex control to draw.
+             * @param[in]   option the style options.
+             * @param[in]   painter the painter to draw with.
+             * @param[in]   widget the widget being drawn.
+             */
+            auto drawComplexControl(
+                    QStyle::ComplexControl control,
+                    const QStyleOptionComplex *option,
+                    QPainter *painter,
+                    const QWidget *widget = nullptr) const -> void override;
+
+            /**
+             * @brief       Reimplements: QProxyStyle::pixelMetric(...).
+             *
+             * @param[in]   metric the metric to return.
+             * @param[in]   option the style options.
+             * @param[in]   widget the widget the metric is for.
+             *
+             * @returns     the value of the metric.
+             */
+            auto pixelMetric(
+                    QStyle::PixelMetric metric,
+                    const QStyleOption *option = nullptr,
+                    const QWidget *widget = nullptr) const -> int override;
+
+            /**
+             * @brief       Reimplements: QProxyStyle::sizeFromContents(...).
+             *
+             * @param[in]   type the type of contents.
+             * @param[in]   option the style options.
+             * @param[in]   contentsSize the size of the contents.
+             * @param[in]   widget the widget the size is for.
+             *
+             * @returns     the size of the element.
+             */
+            auto sizeFromContents(
+                    QStyle::ContentsType type,
+                    const QStyleOption *option,
+                    const QSize &contentsSize,
+                    const QWidget *widget = nullptr) const -> QSize override;
+
+            /**
+             * @brief       Reimplements: QProxyStyle::polish(QWidget *widget).
+             *
+             * @param[in]   widget the widget to polish.
+             */
+            auto polish(QWidget *widget) -> void override;
+
+            using QProxyStyle::polish;
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONSTYLE_H
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonStyleSheetCache.h"
+
+Nedrysoft::Ribbon::RibbonStyleSheetCache::RibbonStyleSheetCache() :
+        m_hits(0),
+        m_misses(0) {
+
+}
+
+auto Nedrysoft::Ribbon::RibbonStyleSheetCache::getInstance() -> Nedrysoft::Ribbon::RibbonStyleSheetCache * {
+    static RibbonStyleSheetCache instance;
+
+    return &instance;
+}
+
+auto Nedrysoft::Ribbon::RibbonStyleSheetCache::styleSheet(
+        const QString &key,
+        Nedrysoft::Ribbon::ThemeMode theme,
+        const std::function<QString()> &builder) -> QString {
+
+    auto cacheKey = qMakePair(key, static_cast<int>(theme));
+
+    auto iterator = m_styleSheets.constFind(cacheKey);
+
+    if (iterator!=m_styleSheets.constEnd()) {
+        m_hits++;
+
+        return iterator.value();
+    }
+
+    m_misses++;
+
+    auto styleSheet = builder();
+
+    m_styleSheets.insert(cacheKey, styleSheet);
+
+    return styleSheet;
+}
+
+auto Nedrysoft::Ribbon::RibbonStyleSheetCache::clear() -> void {
+    m_styleSheets.clear();
+}
+
+auto Nedrysoft::Ribbon::RibbonStyleSheetCache::hits() const -> quint64 {
+    return m_hits;
+}
+
+auto Nedrysoft::Ribbon::RibbonStyleSheetCache::misses() const -> quint64 {
+    return m_misses;
+}
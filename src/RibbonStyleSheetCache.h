@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONSTYLESHEETCACHE_H
+#define NEDRYSOFT_RIBBONSTYLESHEETCACHE_H
+
+#include "RibbonSpec.h"
+#include "RibbonWidget.h"
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <functional>
+
+namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The RibbonStyleSheetCache provides a process wide store of resolved widget stylesheets.
+     *
+     * @details     Each ribbon control builds its stylesheet from a template by substituting the theme colours,
+     *              the result only depends on the widget class and the theme, so the substitution is performed once
+     *              and the resulting (implicitly shared) QString is handed out to every instance.  This class is a
+     *              singleton and therefore cannot be instantiated directly, the instance can be obtained using
+     *              the getInstance() method.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonStyleSheetCache {
+        private:
+            /**
+             * @brief       Constructs a new RibbonStyleSheetCache.
+             *
+             * @note        Cannot be directly instantiated, this is a singleton class and the instance can be
+             *              accessed through the getInstance() method.
+             */
+            explicit RibbonStyleSheetCache();
+
+            /**
+             * @brief       Delete the copy constructor.
+             */
+            RibbonStyleSheetCache(const RibbonStyleSheetCache&) = delete;
+
+            /**
+             * @brief       Delete the assignment operator.
+             */
+            RibbonStyleSheetCache& operator=(const RibbonStyleSheetCache&) = delete;
+
+        public:
+            /**
+             * @brief       Returns the singleton instance of the RibbonStyleSheetCache class.
+             *
+             * @returns     the instance of the class.
+             */
+            static auto getInstance() -> Nedrysoft::Ribbon::RibbonStyleSheetCache *;
+
+            /**
+             * @brief       Returns the resolved stylesheet for the given key and theme.
+             *
+             * @note        The builder is only called if the stylesheet has not previously been resolved, the key
+             *              is normally the class name of the widget, but should also contain any other value that
+             *              the builder substitutes into the stylesheet.
+             *
+             * @param[in]   key the key that identifies the stylesheet.
+             * @param[in]   theme the theme that the stylesheet is resolved for.
+             * @param[in]   builder the function that resolves the stylesheet.
+             *
+             * @returns     the resolved stylesheet.
+             */
+            auto styleSheet(
+                    const QString &key,
+                    Nedrysoft::Ribbon::ThemeMode theme,
+                    const std::function<QString()> &builder) -> QString;
+
+            /**
+             * @brief       Removes all resolved stylesheets from the cache.
+             *
+             * @note        The hit and miss counters are not reset.
+             */
+            auto clear() -> void;
+
+            /**
+             * @brief       Returns the number of requests that were satisfied from the cache.
+             *
+             * @returns     the number of cache hits.
+             */
+            auto hits() const -> quint64;
+
+            /**
+             * @brief       Returns the number of requests that required the stylesheet to be resolved.
+             *
+             * @returns     the number of cache misses.
+             */
+            auto misses() const -> quint64;
+
+        private:
+            //! @cond
+
+            QHash<QPair<QString, int>, QString> m_styleSheets;
+            quint64 m_hits;
+            quint64 m_misses;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONSTYLESHEETCACHE_H
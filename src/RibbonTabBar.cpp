@@ -26,12 +26,18 @@
 #include "RibbonTabBar.h"
 
 #include "RibbonFontManager.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
 #include "RibbonWidget.h"
 
 #include <QApplication>
 #include <QPaintEvent>
 #include <QPainter>
+#include <QResizeEvent>
 #include <QWindow>
+#include <algorithm>
 
 constexpr auto ThemeStylesheet = R"(
     QTabBar::tab {
@@ -44,23 +50,25 @@ Nedrysoft::Ribbon::RibbonTabBar::RibbonTabBar(QWidget *parent) :
 
     auto fontManager = Nedrysoft::Ribbon::RibbonFontManager::getInstance();
 
-    m_normalFont = QFont(fontManager->normalFont(), DefaultFontSize);
-    m_selectedFont = QFont(fontManager->boldFont(), DefaultFontSize, QFont::Bold);
+    m_normalFont = fontManager->font(FontRole::Normal, DefaultFontSize);
+    m_selectedFont = fontManager->font(FontRole::Bold, DefaultFontSize);
 
     m_mouseInWidget = false;
+    m_hoveredTab = -1;
+    m_tabBoundariesValid = false;
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheet(isDarkMode);
     });
 
     updateStyleSheet(themeSupport->isDarkMode());
 
-#if defined(Q_OS_UNIX)
     setMouseTracking(true);
     installEventFilter(this);
-#endif
 }
 
 Nedrysoft::Ribbon::RibbonTabBar::~RibbonTabBar() {
@@ -70,30 +78,28 @@ Nedrysoft::Ribbon::RibbonTabBar::~RibbonTabBar() {
 auto Nedrysoft::Ribbon::RibbonTabBar::eventFilter(QObject *watched, QEvent *event) -> bool {
     Q_UNUSED(watched)
 
-    static auto lastTabIndex = -1;
-
     switch(event->type()) {
         case QEvent::Enter: {
             auto enterEvent = reinterpret_cast<QEnterEvent *>(event);
 
 #if (QT_VERSION_MAJOR>=6)
-            lastTabIndex = tabAt(enterEvent->position().toPoint());
+            m_hoveredTab = hitTest(enterEvent->position().toPoint());
 #else
-            lastTabIndex = tabAt(enterEvent->pos());
+            m_hoveredTab = hitTest(enterEvent->pos());
 #endif
             m_mouseInWidget = true;
 
-            update();
+            update(tabRect(m_hoveredTab));
 
             break;
         }
 
         case QEvent::Leave: {
-            lastTabIndex = -1;
+            update(tabRect(m_hoveredTab));
 
-            m_mouseInWidget = false;
+            m_hoveredTab = -1;
 
-            update();
+            m_mouseInWidget = false;
 
             break;
         }
@@ -106,10 +112,15 @@ auto Nedrysoft::Ribbon::RibbonTabBar::eventFilter(QObject *watched, QEvent *even
 #else
             QPoint mousePosition = mouseEvent->pos();
 #endif
-            if (lastTabIndex != tabAt(mousePosition)) {
-                update();
+            auto tabIndex = hitTest(mousePosition);
 
-                lastTabIndex = tabAt(mousePosition);
+            if (m_hoveredTab != tabIndex) {
+                // only the tabs that have gained or lost the hover state are repainted.
+
+                update(tabRect(m_hoveredTab));
+                update(tabRect(tabIndex));
+
+                m_hoveredTab = tabIndex;
             }
 
             break;
@@ -131,12 +142,77 @@ auto Nedrysoft::Ribbon::RibbonTabBar::tabSizeHint(int index) const -> QSize {
     return size;
 }
 
+auto Nedrysoft::Ribbon::RibbonTabBar::tabLayoutChange() -> void {
+    m_tabBoundariesValid = false;
+
+    QTabBar::tabLayoutChange();
+}
+
+auto Nedrysoft::Ribbon::RibbonTabBar::tabRemoved(int index) -> void {
+    m_tabBoundariesValid = false;
+    m_hoveredTab = -1;
+
+    QTabBar::tabRemoved(index);
+}
+
+auto Nedrysoft::Ribbon::RibbonTabBar::resizeEvent(QResizeEvent *event) -> void {
+    m_tabBoundariesValid = false;
+
+    QTabBar::resizeEvent(event);
+}
+
+auto Nedrysoft::Ribbon::RibbonTabBar::hitTest(const QPoint &point) -> int {
+    // the scroll buttons and the mouse wheel move the tabs without a layout change, so the position is made relative
+    // to the first tab, which moves with the others.
+
+    auto origin = tabRect(0).topLeft();
+
+    if (!m_tabBoundariesValid) {
+        NEDRYSOFT_RIBBON_MEASURE(Layout);
+
+        m_tabBoundaries.clear();
+
+        for (auto tabIndex=0;tabIndex<count();tabIndex++) {
+            auto rect = tabRect(tabIndex).translated(-origin);
+
+            m_tabBoundaries.append(TabBoundary{rect.left(), rect.right(), rect.top(), rect.bottom(), tabIndex});
+        }
+
+        std::sort(m_tabBoundaries.begin(), m_tabBoundaries.end(), [](const TabBoundary &a, const TabBoundary &b) {
+            return a.left<b.left;
+        });
+
+        m_tabBoundariesValid = true;
+    }
+
+    auto position = point-origin;
+
+    auto iterator = std::upper_bound(
+            m_tabBoundaries.constBegin(),
+            m_tabBoundaries.constEnd(),
+            position.x(),
+            [](int x, const TabBoundary &boundary) {
+
+        return x<boundary.left;
+    });
+
+    if (iterator==m_tabBoundaries.constBegin()) {
+        return -1;
+    }
+
+    iterator--;
+
+    if ((position.x()>iterator->right) || (position.y()<iterator->top) || (position.y()>iterator->bottom)) {
+        return -1;
+    }
+
+    return iterator->index;
+}
+
 auto Nedrysoft::Ribbon::RibbonTabBar::paintEvent(QPaintEvent *event) -> void {
-    Q_UNUSED(event)
-    auto globalCursorPos = QCursor::pos();
-    auto textRect = QRect();
-    auto cursorPos = mapFromGlobal(globalCursorPos);
-    auto hoveredTab = tabAt(cursorPos);
+    NEDRYSOFT_RIBBON_MEASURE(Paint);
+
+    auto hoveredTab = m_hoveredTab;
     QColor backgroundColor;
     QPainter painter(this);
     auto  currentTheme = Ribbon::Light;
@@ -158,6 +234,12 @@ auto Nedrysoft::Ribbon::RibbonTabBar::paintEvent(QPaintEvent *event) -> void {
     for(auto tabIndex=0;tabIndex<count();tabIndex++) {
         auto rect = tabRect(tabIndex);
 
+        // only tabs that are within the dirty region need to be redrawn.
+
+        if (!event->region().intersects(rect)) {
+            continue;
+        }
+
 #if defined(Q_OS_MACOS)
         rect.adjust(0,0,0,-4);
 #endif
@@ -167,17 +249,14 @@ auto Nedrysoft::Ribbon::RibbonTabBar::paintEvent(QPaintEvent *event) -> void {
             backgroundColor = Ribbon::TabBarBackgroundColor[currentTheme];
         }
 
-        if (tabIndex==currentIndex()) {
-            painter.setFont(m_selectedFont);
-        } else {
-            painter.setFont(m_normalFont);
-        }
-
         painter.fillRect(rect, backgroundColor);
 
-        painter.setPen(Ribbon::TextColor[currentTheme]);
+        auto textPixmap = tabTextPixmap(tabIndex, currentTheme);
+        auto textRect = QRect(QPoint(0, 0), textPixmap.size()/textPixmap.devicePixelRatio());
+
+        textRect.moveCenter(rect.center());
 
-        painter.drawText(rect, Qt::AlignHCenter | Qt::AlignVCenter, tabText(tabIndex), &textRect);
+        painter.drawPixmap(textRect.topLeft(), textPixmap);
 
         rect.setTop(rect.bottom()-Ribbon::TabHighlightHeight);
 
@@ -194,10 +273,70 @@ auto Nedrysoft::Ribbon::RibbonTabBar::paintEvent(QPaintEvent *event) -> void {
     painter.restore();
 }
 
+auto Nedrysoft::Ribbon::RibbonTabBar::tabTextPixmap(int index, Nedrysoft::Ribbon::ThemeMode theme) -> QPixmap {
+    auto text = tabText(index);
+    auto isSelected = (index==currentIndex());
+    auto font = isSelected ? m_selectedFont : m_normalFont;
+    auto devicePixelRatio = devicePixelRatioF();
+
+    auto key = QString("%1:%2:%3:%4")
+            .arg(text)
+            .arg(font.key())
+            .arg(static_cast<int>(theme))
+            .arg(devicePixelRatio);
+
+    auto iterator = m_textPixmaps.constFind(key);
+
+    if (iterator!=m_textPixmaps.constEnd()) {
+        return iterator.value();
+    }
+
+    // each tab can be drawn with the normal or selected font in either theme, anything beyond that is stale.
+
+    if (m_textPixmaps.count()>=count()*4) {
+        m_textPixmaps.clear();
+    }
+
+    auto fontManager = Nedrysoft::Ribbon::RibbonFontManager::getInstance();
+
+    auto fontMetrics = fontManager->fontMetrics(isSelected ? FontRole::Bold : FontRole::Normal, DefaultFontSize);
+    auto textSize = fontMetrics.size(Qt::TextSingleLine, text);
+
+    QPixmap pixmap(textSize*devicePixelRatio);
+
+    pixmap.setDevicePixelRatio(devicePixelRatio);
+    pixmap.fill(Qt::transparent);
+
+    QPainter painter(&pixmap);
+
+    painter.setFont(font);
+    painter.setPen(Ribbon::TextColor[theme]);
+    painter.drawText(QRect(QPoint(0, 0), textSize), Qt::AlignHCenter | Qt::AlignVCenter, text);
+    painter.end();
+
+    m_textPixmaps.insert(key, pixmap);
+
+    return pixmap;
+}
+
 auto Nedrysoft::Ribbon::RibbonTabBar::updateStyleSheet(bool isDarkMode) -> void {
-    Q_UNUSED(isDarkMode)
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
+
+    if (RibbonStyle::isActive()) {
+        update();
+
+        return;
+    }
+
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
 
-    QString styleSheet(ThemeStylesheet);
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            []() {
+
+        return QString(ThemeStylesheet);
+    });
 
     setStyleSheet(styleSheet);
 }
@@ -25,9 +25,13 @@
 #define NEDRYSOFT_RIBBONTABBAR_H
 
 #include "RibbonSpec.h"
+#include "RibbonWidget.h"
 
 #include <QFont>
+#include <QHash>
+#include <QPixmap>
 #include <QTabBar>
+#include <QVector>
 #include <ThemeSupport>
 
 namespace Nedrysoft { namespace Ribbon {
@@ -85,6 +89,25 @@ namespace Nedrysoft { namespace Ribbon {
              */
             auto eventFilter(QObject *watched, QEvent *event) -> bool override;
 
+            /**
+             * @brief       Reimplements: QTabBar::tabLayoutChange().
+             */
+            auto tabLayoutChange() -> void override;
+
+            /**
+             * @brief       Reimplements: QTabBar::tabRemoved(int index).
+             *
+             * @param[in]   index the index of the tab that was removed.
+             */
+            auto tabRemoved(int index) -> void override;
+
+            /**
+             * @brief       Reimplements: QWidget::resizeEvent(QResizeEvent *event).
+             *
+             * @param[in]   event the event information.
+             */
+            auto resizeEvent(QResizeEvent *event) -> void override;
+
         private:
             /**
              * @brief       Updates the widgets stylesheet when the operating system theme is changed.
@@ -93,12 +116,51 @@ namespace Nedrysoft { namespace Ribbon {
              */
             auto updateStyleSheet(bool isDarkMode) -> void;
 
+            /**
+             * @brief       Returns the pre-rendered text of the tab at position index.
+             *
+             * @details     The pixmaps are cached by text, font, theme and device pixel ratio so that painting
+             *              the tab bar does not require the text to be laid out again.
+             *
+             * @param[in]   index the index of the tab.
+             * @param[in]   theme the current theme.
+             *
+             * @returns     the pixmap containing the tab text.
+             */
+            auto tabTextPixmap(int index, Nedrysoft::Ribbon::ThemeMode theme) -> QPixmap;
+
+            /**
+             * @brief       Returns the index of the tab at the given position.
+             *
+             * @details     Uses a cached array of the tab boundaries sorted by x position, so the tab can be found
+             *              with a binary search; the array is rebuilt when the tab layout changes or the tab bar is
+             *              resized.  The boundaries are relative to the first tab, so scrolling the tabs (which
+             *              moves them all by the same amount) does not require the array to be rebuilt.
+             *
+             * @param[in]   point the position in widget coordinates.
+             *
+             * @returns     the index of the tab; otherwise -1 if there is no tab at the position.
+             */
+            auto hitTest(const QPoint &point) -> int;
+
         private:
             //! @cond
 
             QFont m_selectedFont;
             QFont m_normalFont;
+            struct TabBoundary {
+                int left;
+                int right;
+                int top;
+                int bottom;
+                int index;
+            };
+
             bool m_mouseInWidget;
+            int m_hoveredTab;
+            QHash<QString, QPixmap> m_textPixmaps;
+            QVector<TabBoundary> m_tabBoundaries;
+            bool m_tabBoundariesValid;
 
             //! @endcond
     };
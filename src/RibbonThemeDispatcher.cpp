@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RibbonThemeDispatcher.h"
+
+#include "RibbonWidget.h"
+
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QVector>
+#include <QWidget>
+#include <ThemeSupport>
+
+static auto owningWidget(QWidget *control) -> QWidget * {
+    QWidget *ribbonWidget = nullptr;
+
+    for (auto widget=control;widget;widget=widget->parentWidget()) {
+        if (qobject_cast<Nedrysoft::Ribbon::RibbonWidget *>(widget)) {
+            ribbonWidget = widget;
+        }
+    }
+
+    if (ribbonWidget) {
+        return ribbonWidget;
+    }
+
+    return control->window();
+}
+
+Nedrysoft::Ribbon::RibbonThemeDispatcher::RibbonThemeDispatcher() :
+        m_lastSwitchDuration(0) {
+
+    auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
+
+    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged,
+            this, &Nedrysoft::Ribbon::RibbonThemeDispatcher::applyTheme);
+}
+
+auto Nedrysoft::Ribbon::RibbonThemeDispatcher::getInstance() -> Nedrysoft::Ribbon::RibbonThemeDispatcher * {
+    static RibbonThemeDispatcher instance;
+
+    return &instance;
+}
+
+auto Nedrysoft::Ribbon::RibbonThemeDispatcher::registerControl(
+        QWidget *control,
+        const std::function<void(bool)> &applyTheme) -> void {
+
+    if (!m_controls.contains(control)) {
+        connect(control, &QObject::destroyed, this, &Nedrysoft::Ribbon::RibbonThemeDispatcher::unregisterControl);
+    }
+
+    m_controls.insert(control, Registration{control, applyTheme});
+}
+
+auto Nedrysoft::Ribbon::RibbonThemeDispatcher::unregisterControl(QObject *control) -> void {
+    if (m_controls.remove(control)) {
+        disconnect(control, &QObject::destroyed, this, &Nedrysoft::Ribbon::RibbonThemeDispatcher::unregisterControl);
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonThemeDispatcher::applyTheme(bool isDarkMode) -> void {
+    QElapsedTimer timer;
+    QVector<QPointer<QWidget>> suspendedWidgets;
+
+    timer.start();
+
+    // take a copy, a control may create or destroy other controls while the theme is applied.
+
+    auto controls = m_controls;
+
+    // a widget whose updates are already disabled has either been suspended by this pass or by its owner, in both
+    // cases it is left alone.
+
+    for (const auto &registration : controls) {
+        auto widget = owningWidget(registration.control);
+
+        if (widget->updatesEnabled()) {
+            widget->setUpdatesEnabled(false);
+
+            suspendedWidgets.append(widget);
+        }
+    }
+
+    for (const auto &registration : controls) {
+        if (m_controls.contains(registration.control)) {
+            registration.applyTheme(isDarkMode);
+        }
+    }
+
+    // a handler may destroy a ribbon while the theme is applied, the guarded pointers are cleared if it does.
+
+    for (const auto &widget : suspendedWidgets) {
+        if (widget) {
+            widget->setUpdatesEnabled(true);
+            widget->repaint();
+        }
+    }
+
+    m_lastSwitchDuration = timer.nsecsElapsed();
+
+    Q_EMIT themeApplied(isDarkMode, m_lastSwitchDuration);
+}
+
+auto Nedrysoft::Ribbon::RibbonThemeDispatcher::lastSwitchDuration() const -> qint64 {
+    return m_lastSwitchDuration;
+}
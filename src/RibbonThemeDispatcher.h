@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Adrian Carpenter
+ *
+ * This file is part of the Nedrysoft Ribbon Bar. (https://github.com/nedrysoft/qt-ribbon)
+ *
+ * A cross-platform ribbon bar for Qt applications.
+ *
+ * Created by Adrian Carpenter on 17/10/2026.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NEDRYSOFT_RIBBONTHEMEDISPATCHER_H
+#define NEDRYSOFT_RIBBONTHEMEDISPATCHER_H
+
+#include "RibbonSpec.h"
+
+#include <QHash>
+#include <QObject>
+#include <functional>
+
+class QWidget;
+
+namespace Nedrysoft { namespace Ribbon {
+    /**
+     * @brief       The RibbonThemeDispatcher applies a theme change to every ribbon control in a single pass.
+     *
+     * @details     Ribbon controls register with the dispatcher rather than connecting to the ThemeSupport
+     *              themeChanged signal individually.  When the theme changes, updates are suspended on each
+     *              RibbonWidget that owns a registered control, the new theme is applied to all controls and then
+     *              each RibbonWidget is repainted once.  This class is a singleton and therefore cannot be
+     *              instantiated directly, the instance can be obtained using the getInstance() method.
+     */
+    class NEDRYSOFT_RIBBON_WIDGET_EXPORT RibbonThemeDispatcher :
+            public QObject {
+
+        private:
+            Q_OBJECT
+
+        private:
+            /**
+             * @brief       Constructs a new RibbonThemeDispatcher.
+             *
+             * @note        Cannot be directly instantiated, this is a singleton class and the instance can be
+             *              accessed through the getInstance() method.
+             */
+            explicit RibbonThemeDispatcher();
+
+            /**
+             * @brief       Delete the copy constructor.
+             */
+            RibbonThemeDispatcher(const RibbonThemeDispatcher&) = delete;
+
+            /**
+             * @brief       Delete the assignment operator.
+             */
+            RibbonThemeDispatcher& operator=(const RibbonThemeDispatcher&) = delete;
+
+        public:
+            /**
+             * @brief       Returns the singleton instance of the RibbonThemeDispatcher class.
+             *
+             * @returns     the instance of the class.
+             */
+            static auto getInstance() -> Nedrysoft::Ribbon::RibbonThemeDispatcher *;
+
+            /**
+             * @brief       Registers a control to be notified when the theme changes.
+             *
+             * @note        The control is automatically unregistered when it is destroyed.
+             *
+             * @param[in]   control the control.
+             * @param[in]   applyTheme the function that updates the control for the new theme.
+             */
+            auto registerControl(QWidget *control, const std::function<void(bool)> &applyTheme) -> void;
+
+            /**
+             * @brief       Unregisters a control.
+             *
+             * @param[in]   control the control.
+             */
+            auto unregisterControl(QObject *control) -> void;
+
+            /**
+             * @brief       Applies the theme to all registered controls.
+             *
+             * @note        Called when the ThemeSupport themeChanged signal is emitted.
+             *
+             * @param[in]   isDarkMode true if dark mode; otherwise false.
+             */
+            auto applyTheme(bool isDarkMode) -> void;
+
+            /**
+             * @brief       Returns the time taken by the last theme switch.
+             *
+             * @note        The time includes applying the theme to every control and repainting the ribbons.
+             *
+             * @returns     the duration in nanoseconds.
+             */
+            auto lastSwitchDuration() const -> qint64;
+
+        public:
+            /**
+             * @brief       Emitted when a theme switch has completed.
+             *
+             * @param[in]   isDarkMode true if dark mode; otherwise false.
+             * @param[in]   duration the time taken by the switch in nanoseconds.
+             */
+            Q_SIGNAL void themeApplied(bool isDarkMode, qint64 duration);
+
+        private:
+            //! @cond
+
+            struct Registration {
+                QWidget *control;
+                std::function<void(bool)> applyTheme;
+            };
+
+            QHash<QObject *, Registration> m_controls;
+            qint64 m_lastSwitchDuration;
+
+            //! @endcond
+    };
+}}
+
+#endif // NEDRYSOFT_RIBBONTHEMEDISPATCHER_H
@@ -23,6 +23,10 @@
 
 #include "RibbonToolButton.h"
 
+#include "RibbonInstrumentation.h"
+#include "RibbonStyle.h"
+#include "RibbonStyleSheetCache.h"
+#include "RibbonThemeDispatcher.h"
 #include "RibbonWidget.h"
 
 #include <QApplication>
@@ -46,7 +50,9 @@ Nedrysoft::Ribbon::RibbonToolButton::RibbonToolButton(QWidget *parent) :
 
     auto themeSupport = Nedrysoft::ThemeSupport::ThemeSupport::getInstance();
 
-    connect(themeSupport, &Nedrysoft::ThemeSupport::ThemeSupport::themeChanged, [=](bool isDarkMode) {
+    auto themeDispatcher = RibbonThemeDispatcher::getInstance();
+
+    themeDispatcher->registerControl(this, [=](bool isDarkMode) {
         updateStyleSheet(isDarkMode);
     });
 
@@ -57,14 +63,32 @@ Nedrysoft::Ribbon::RibbonToolButton::~RibbonToolButton() {
 }
 
 auto Nedrysoft::Ribbon::RibbonToolButton::updateStyleSheet(bool isDarkMode) -> void {
-    QString styleSheet(ThemeStylesheet);
+    NEDRYSOFT_RIBBON_MEASURE(StyleSheet);
+
+    if (RibbonStyle::isActive()) {
+        update();
 
-    if (isDarkMode) {
-        styleSheet.replace("[background-colour]", "#434343");
-        styleSheet.replace("[hover-colour]", "#616161");
-    } else {
-        styleSheet.replace("[background-colour]", "#ffffff");
+        return;
     }
 
+    auto styleSheetCache = RibbonStyleSheetCache::getInstance();
+
+    auto styleSheet = styleSheetCache->styleSheet(
+            staticMetaObject.className(),
+            isDarkMode ? Nedrysoft::Ribbon::Dark : Nedrysoft::Ribbon::Light,
+            [isDarkMode]() {
+
+        QString styleSheet(ThemeStylesheet);
+
+        if (isDarkMode) {
+            styleSheet.replace("[background-colour]", "#434343");
+            styleSheet.replace("[hover-colour]", "#616161");
+        } else {
+            styleSheet.replace("[background-colour]", "#ffffff");
+        }
+
+        return styleSheet;
+    });
+
     setStyleSheet(styleSheet);
 }
@@ -23,11 +23,17 @@
 
 #include "RibbonWidget.h"
 
+#include "RibbonFontManager.h"
+#include "RibbonInstrumentation.h"
+#include "RibbonReductionEngine.h"
+#include "RibbonStyle.h"
 #include "RibbonTabBar.h"
 
 #include <QApplication>
+#include <QElapsedTimer>
 #include <QPaintEvent>
 #include <QPainter>
+#include <QTimer>
 
 constexpr auto ThemeStylesheet = R"(
     QWidget {
@@ -41,20 +47,48 @@ constexpr auto ThemeStylesheet = R"(
 )";
 
 Nedrysoft::Ribbon::RibbonWidget::RibbonWidget(QWidget *parent) :
-        QTabWidget(parent) {
+        QTabWidget(parent),
+        m_adaptiveReduction(false),
+        m_idleConstructionEnabled(true),
+        m_idleConstructionScheduled(false),
+        m_painted(false) {
 
     m_tabBar = new RibbonTabBar(this);
 
     setTabBar(m_tabBar);
-    setStyleSheet(ThemeStylesheet);
+
+    if (RibbonStyle::isActive()) {
+        auto fontManager = RibbonFontManager::getInstance();
+
+        setFont(fontManager->font(FontRole::Normal, DefaultFontSize));
+    } else {
+        setStyleSheet(ThemeStylesheet);
+    }
 
     setMinimumHeight(RibbonBarHeight+TabBarHeight);
     setMaximumHeight(RibbonBarHeight+TabBarHeight);
 
     setDocumentMode(true);
+
+    connect(this, &QTabWidget::currentChanged, [=](int index) {
+        constructPage(index);
+    });
+}
+
+Nedrysoft::Ribbon::RibbonWidget::~RibbonWidget() {
+    // the pages are deleted by ~QWidget after the members have been destroyed, so the connections that use
+    // m_lazyPages must not fire while they are removed.
+
+    disconnect(this, &QTabWidget::currentChanged, nullptr, nullptr);
+
+    for (auto iterator = m_lazyPages.constBegin(); iterator!=m_lazyPages.constEnd(); iterator++) {
+        disconnect(iterator.key(), &QObject::destroyed, this, nullptr);
+    }
 }
 
 auto Nedrysoft::Ribbon::RibbonWidget::paintEvent(QPaintEvent *event) -> void {
+    NEDRYSOFT_RIBBON_MEASURE(Paint);
+
     Q_UNUSED(event)
     QPainter painter(this);
     auto widgetRect = rect();
@@ -75,6 +109,16 @@ auto Nedrysoft::Ribbon::RibbonWidget::paintEvent(QPaintEvent *event) -> void {
     painter.fillRect(widgetRect, RibbonBorderColor[currentTheme]);
 
     painter.restore();
+
+    if (!m_painted) {
+        m_painted = true;
+
+        if ((m_idleConstructionEnabled) && (!m_lazyPages.isEmpty())) {
+            m_idleConstructionScheduled = true;
+
+            QTimer::singleShot(0, this, &RibbonWidget::constructIdlePage);
+        }
+    }
 }
 
 auto Nedrysoft::Ribbon::RibbonWidget::backgroundColor() -> QColor {
@@ -88,3 +132,198 @@ auto Nedrysoft::Ribbon::RibbonWidget::backgroundColor() -> QColor {
 
     return TabBarBackgroundColor[currentTheme];
 }
+
+auto Nedrysoft::Ribbon::RibbonWidget::addLazyTab(
+        const QString &label,
+        const std::function<QWidget *()> &factory) -> int {
+
+    auto placeholder = new QWidget;
+    auto layout = new QHBoxLayout(placeholder);
+
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->setSpacing(0);
+
+    // the page must be registered before the tab is added, adding the first tab selects it.
+
+    m_lazyPages.insert(placeholder, LazyPage{factory, -1, false});
+
+    // the entry (and anything captured by the factory) is released with the placeholder.
+
+    connect(placeholder, &QObject::destroyed, this, [this, placeholder]() {
+        m_lazyPages.remove(placeholder);
+    });
+
+    auto index = addTab(placeholder, label);
+
+    if ((m_painted) && (m_idleConstructionEnabled) && (!m_idleConstructionScheduled)) {
+        m_idleConstructionScheduled = true;
+
+        QTimer::singleShot(0, this, &RibbonWidget::constructIdlePage);
+    }
+
+    return index;
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::isLazyPage(QWidget *placeholder) -> bool {
+    return m_lazyPages.contains(placeholder);
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::constructPage(int index) -> void {
+    auto placeholder = widget(index);
+
+    if (!isLazyPage(placeholder)) {
+        return;
+    }
+
+    if (m_lazyPages[placeholder].constructed) {
+        return;
+    }
+
+    QElapsedTimer timer;
+
+    timer.start();
+
+    // the factory may itself add lazy tabs, so the entry is not referenced while it runs.
+
+    auto factory = m_lazyPages[placeholder].factory;
+
+    m_lazyPages[placeholder].constructed = true;
+    m_lazyPages[placeholder].factory = nullptr;
+
+    auto page = factory();
+
+    if (page) {
+        placeholder->layout()->addWidget(page);
+    }
+
+    auto duration = timer.nsecsElapsed();
+
+    m_lazyPages[placeholder].duration = duration;
+
+    if (m_adaptiveReduction) {
+        attachReductionEngine(placeholder);
+    }
+
+    Q_EMIT pageConstructed(index, duration);
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::pageConstructionTime(int index) -> qint64 {
+    auto placeholder = widget(index);
+
+    if (!isLazyPage(placeholder)) {
+        return -1;
+    }
+
+    return m_lazyPages[placeholder].duration;
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::setIdleConstructionEnabled(bool enabled) -> void {
+    m_idleConstructionEnabled = enabled;
+
+    // if the ribbon has already been painted the idle pass that paintEvent would have started is started here.
+
+    if ((m_painted) && (m_idleConstructionEnabled) && (!m_idleConstructionScheduled) && (!m_lazyPages.isEmpty())) {
+        m_idleConstructionScheduled = true;
+
+        QTimer::singleShot(0, this, &RibbonWidget::constructIdlePage);
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::constructIdlePage() -> void {
+    m_idleConstructionScheduled = false;
+
+    if (!m_idleConstructionEnabled) {
+        return;
+    }
+
+    for (auto tabIndex=0;tabIndex<count();tabIndex++) {
+        auto placeholder = widget(tabIndex);
+
+        if ((!isLazyPage(placeholder)) || (m_lazyPages[placeholder].constructed)) {
+            continue;
+        }
+
+        constructPage(tabIndex);
+
+        // construct one page per pass so that the event loop remains responsive.
+
+        m_idleConstructionScheduled = true;
+
+        QTimer::singleShot(0, this, &RibbonWidget::constructIdlePage);
+
+        return;
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::tabInserted(int index) -> void {
+    QTabWidget::tabInserted(index);
+
+    // lazy pages have no groups until they are constructed, the engine is attached in constructPage.
+
+    if ((m_adaptiveReduction) && (!isLazyPage(widget(index)))) {
+        attachReductionEngine(widget(index));
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::setAdaptiveReduction(bool enabled) -> void {
+    if (m_adaptiveReduction==enabled) {
+        return;
+    }
+
+    m_adaptiveReduction = enabled;
+
+    if (!enabled) {
+        qDeleteAll(findChildren<RibbonReductionEngine *>());
+
+        for (auto index = 0; index<count(); index++) {
+            widget(index)->removeEventFilter(this);
+        }
+
+        return;
+    }
+
+    for (auto index = 0; index<count(); index++) {
+        auto page = widget(index);
+
+        if ((!isLazyPage(page)) || (m_lazyPages[page].constructed)) {
+            attachReductionEngine(page);
+        }
+    }
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::adaptiveReduction() -> bool {
+    return m_adaptiveReduction;
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::attachReductionEngine(QWidget *page) -> void {
+    if (page->findChild<RibbonReductionEngine *>(QString(), Qt::FindDirectChildrenOnly)) {
+        return;
+    }
+
+    auto reductionEngine = new RibbonReductionEngine(page);
+
+    if (reductionEngine->isValid()) {
+        page->removeEventFilter(this);
+
+        return;
+    }
+
+    delete reductionEngine;
+
+    // the page is usually added before its groups, the layout of the page is invalidated when a group is added to
+    // it so the engine is attached on the next layout request.
+
+    page->installEventFilter(this);
+}
+
+auto Nedrysoft::Ribbon::RibbonWidget::eventFilter(QObject *watched, QEvent *event) -> bool {
+    if ((event->type()==QEvent::LayoutRequest) && (m_adaptiveReduction) && (watched->isWidgetType())) {
+        auto page = static_cast<QWidget *>(watched);
+
+        if ((indexOf(page)>=0) && ((!isLazyPage(page)) || (m_lazyPages[page].constructed))) {
+            attachReductionEngine(page);
+        }
+    }
+
+    return QTabWidget::eventFilter(watched, event);
+}
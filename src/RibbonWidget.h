@@ -29,8 +29,10 @@
 #include "RibbonSpec.h"
 
 #include <QHBoxLayout>
+#include <QHash>
 #include <QMetaProperty>
 #include <QTabWidget>
+#include <functional>
 
 namespace Nedrysoft { namespace Ribbon {
     class RibbonTabBar;
@@ -99,6 +101,54 @@ namespace Nedrysoft { namespace Ribbon {
         qRgb(65, 65, 65)
     };
 
+    /**
+     * @brief       Colour of the push button when the mouse is being held down
+     */
+    static constexpr QRgb PushButtonPressedColor[] = {
+        qRgb(0xb8, 0xab, 0xaa),
+        qRgb(0x29, 0x29, 0x29)
+    };
+
+    /**
+     * @brief       Colour of the monochrome glyphs tinted by RibbonIconTinter
+     */
+    static constexpr QRgb GlyphColor[] = {
+        qRgb(0x00, 0x00, 0x00),
+        qRgb(0xff, 0xff, 0xff)
+    };
+
+    /**
+     * @brief       Background colour of a ribbon control
+     */
+    static constexpr QRgb ControlBackgroundColor[] = {
+        qRgb(0xff, 0xff, 0xff),
+        qRgb(0x43, 0x43, 0x43)
+    };
+
+    /**
+     * @brief       Colour of a ribbon control when hovered over
+     */
+    static constexpr QRgb ControlHoverColor[] = {
+        qRgb(0xdd, 0xdd, 0xdd),
+        qRgb(0x4c, 0x4c, 0x4c)
+    };
+
+    /**
+     * @brief       Colour of a ribbon control when the mouse is being held down
+     */
+    static constexpr QRgb ControlPressedColor[] = {
+        qRgb(0x80, 0x80, 0x80),
+        qRgb(0x29, 0x29, 0x29)
+    };
+
+    /**
+     * @brief       Colour of the slider groove
+     */
+    static constexpr QRgb SliderGrooveColor[] = {
+        qRgb(0xc8, 0xc9, 0xc8),
+        qRgb(0x43, 0x43, 0x43)
+    };
+
     /**
      * @note        Small tweaks are required on a OS level to ensure that the rendered RibbonBar looks correct
      *              on each platform.
@@ -138,6 +188,11 @@ namespace Nedrysoft { namespace Ribbon {
              */
             explicit RibbonWidget(QWidget *parent = nullptr);
 
+            /**
+             * @brief       Destroys the RibbonWidget.
+             */
+            ~RibbonWidget() override;
+
             /**
              * @brief       Returns the ribbon bar background color.
              *
@@ -145,6 +200,72 @@ namespace Nedrysoft { namespace Ribbon {
              */
             auto backgroundColor() -> QColor;
 
+            /**
+             * @brief       Adds a tab whose page is constructed when it is first needed.
+             *
+             * @details     The factory is called the first time the tab is selected, or when the application is
+             *              idle after the ribbon has been painted for the first time if idle construction is enabled.
+             *
+             * @param[in]   label the label of the tab.
+             * @param[in]   factory the function that creates the page, the ribbon takes ownership of the page.
+             *
+             * @returns     the index of the new tab.
+             */
+            auto addLazyTab(const QString &label, const std::function<QWidget *()> &factory) -> int;
+
+            /**
+             * @brief       Constructs the page of a lazy tab if it has not already been constructed.
+             *
+             * @param[in]   index the index of the tab.
+             */
+            auto constructPage(int index) -> void;
+
+            /**
+             * @brief       Returns the time taken to construct the page of a lazy tab.
+             *
+             * @param[in]   index the index of the tab.
+             *
+             * @returns     the duration in nanoseconds; otherwise -1 if the page has not been constructed or the tab
+             *              was not added with addLazyTab.
+             */
+            auto pageConstructionTime(int index) -> qint64;
+
+            /**
+             * @brief       Sets whether lazy pages are constructed when the application is idle.
+             *
+             * @note        Idle construction is enabled by default, one page is constructed on each pass of the
+             *              event loop after the first paint.
+             *
+             * @param[in]   enabled true if idle construction is enabled; otherwise false.
+             */
+            auto setIdleConstructionEnabled(bool enabled) -> void;
+
+            /**
+             * @brief       Sets whether groups are collapsed when the ribbon is too narrow to show them.
+             *
+             * @note        Adaptive reduction is disabled by default, when enabled a RibbonReductionEngine is
+             *              attached to each page as it is added or constructed.
+             *
+             * @param[in]   enabled true if groups should be collapsed to fit; otherwise false.
+             */
+            auto setAdaptiveReduction(bool enabled) -> void;
+
+            /**
+             * @brief       Returns whether groups are collapsed when the ribbon is too narrow to show them.
+             *
+             * @returns     true if adaptive reduction is enabled; otherwise false.
+             */
+            auto adaptiveReduction() -> bool;
+
+        public:
+            /**
+             * @brief       Emitted when the page of a lazy tab has been constructed.
+             *
+             * @param[in]   index the index of the tab.
+             * @param[in]   duration the time taken to construct the page in nanoseconds.
+             */
+            Q_SIGNAL void pageConstructed(int index, qint64 duration);
+
             friend class RibbonTabBar;
             friend class RibbonGroup;
 
@@ -156,10 +277,65 @@ namespace Nedrysoft { namespace Ribbon {
              */
             auto paintEvent(QPaintEvent *event) -> void override;
 
+            /**
+             * @brief       Reimplements: QTabWidget::tabInserted(int index).
+             *
+             * @param[in]   index the index of the inserted tab.
+             */
+            auto tabInserted(int index) -> void override;
+
+            /**
+             * @brief       Reimplements: QObject::eventFilter(QObject *watched, QEvent *event).
+             *
+             * @note        Used to attach a reduction engine to a page once groups have been added to it.
+             *
+             * @param[in]   watched the object that caused the event.
+             * @param[in]   event the event information.
+             *
+             * @returns     true if the event was handled; otherwise false.
+             */
+            auto eventFilter(QObject *watched, QEvent *event) -> bool override;
+
+        private:
+            /**
+             * @brief       Attaches a reduction engine to the page if it does not already have one.
+             *
+             * @note        If the page does not contain any groups yet, the page is watched and the engine is
+             *              attached when its layout next changes.
+             *
+             * @param[in]   page the page widget.
+             */
+            auto attachReductionEngine(QWidget *page) -> void;
+
+            /**
+             * @brief       Constructs the next unconstructed lazy page and schedules the following one.
+             */
+            auto constructIdlePage() -> void;
+
+            /**
+             * @brief       Returns whether the widget is the placeholder of a lazy page.
+             *
+             * @param[in]   placeholder the page widget of the tab.
+             *
+             * @returns     true if the widget is a lazy page placeholder; otherwise false.
+             */
+            auto isLazyPage(QWidget *placeholder) -> bool;
+
         private:
             //! @cond
 
+            struct LazyPage {
+                std::function<QWidget *()> factory;
+                qint64 duration;
+                bool constructed;
+            };
+
             Nedrysoft::Ribbon::RibbonTabBar *m_tabBar;
+            QHash<QWidget *, LazyPage> m_lazyPages;
+            bool m_adaptiveReduction;
+            bool m_idleConstructionEnabled;
+            bool m_idleConstructionScheduled;
+            bool m_painted;
 
             //! @endcond
     };
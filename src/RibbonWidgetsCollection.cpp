@@ -30,6 +30,8 @@
 #include "RibbonGroupPlugin.h"
 #include "RibbonLineEditPlugin.h"
 #include "RibbonPushButtonPlugin.h"
+#include "RibbonSingleLineEditPlugin.h"
+#include "RibbonSplitButtonPlugin.h"
 #include "RibbonToolButtonPlugin.h"
 #include "RibbonWidgetPlugin.h"
 #include "RibbonSliderPlugin.h"
@@ -40,8 +42,10 @@ RibbonWidgetsCollection::RibbonWidgetsCollection(QObject *parent) :
     m_widgets.append(new RibbonGroupPlugin(this));
     m_widgets.append(new RibbonWidgetPlugin(this));
     m_widgets.append(new RibbonDropButtonPlugin(this));
+    m_widgets.append(new RibbonSplitButtonPlugin(this));
     m_widgets.append(new RibbonPushButtonPlugin(this));
     m_widgets.append(new RibbonLineEditPlugin(this));
+    m_widgets.append(new RibbonSingleLineEditPlugin(this));
     m_widgets.append(new RibbonComboBoxPlugin(this));
     m_widgets.append(new RibbonCheckBoxPlugin(this));
     m_widgets.append(new RibbonToolButtonPlugin(this));